@@ -0,0 +1,64 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - AIBatch.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include "Direction.hpp"
+
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+
+
+enum class AIPredicate : std::uint8_t
+{
+    WithinVisionRange = (1 << 0), WithinAttackRange = (1 << 1), WithinPatrolRange = (1 << 2), FacingTarget = (1 << 3)
+};
+
+struct AIProfile
+{
+    sf::Vector2f position;
+    float visionRange;
+    float attackRange;
+    std::pair<float, float> patrolRange;
+    Direction direction;
+    float facingHeight;
+};
+
+class AIBatch
+{
+public:
+    void clear();
+
+    void addTarget(const AIProfile& profile, const sf::Vector2f& targetPosition);
+
+    void evaluate();
+
+    bool hasPredicate(std::size_t index, AIPredicate predicate) const;
+
+    std::size_t size() const;
+
+private:
+    std::vector<float> AIXPositions;
+    std::vector<float> AIYPositions;
+    std::vector<float> targetXPositions;
+    std::vector<float> targetYPositions;
+    std::vector<float> visionRanges;
+    std::vector<float> attackRanges;
+    std::vector<float> patrolMinimums;
+    std::vector<float> patrolMaximums;
+    std::vector<float> facingDirections;
+    std::vector<float> facingHeights;
+    std::vector<float> alwaysFacing;
+
+    std::vector<std::uint8_t> masks;
+
+    void evaluateRange(std::size_t begin, std::size_t end);
+};
\ No newline at end of file
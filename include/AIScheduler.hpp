@@ -0,0 +1,45 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - AIScheduler.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <unordered_map>
+
+
+class AIScheduler
+{
+public:
+    AIScheduler(float timeBudget, float nearDistance, float farDistance);
+
+    void beginFrame();
+
+    std::optional<std::size_t> getOverdueFrames(std::int32_t AIID, float distance);
+
+    void markUpdated(std::int32_t AIID);
+
+    bool hasBudgetLeft(std::size_t scheduledAgents) const;
+
+    void setTickRateScale(float tickRateScale);
+    void setAgentBudget(std::size_t agentBudget);
+
+private:
+    std::unordered_map<std::int32_t, std::size_t> lastUpdates;
+    std::chrono::high_resolution_clock::time_point frameStart;
+    std::size_t currentFrame;
+
+    float timeBudget;
+    float nearDistance;
+    float farDistance;
+    float tickRateScale;
+    std::size_t agentBudget;
+
+    std::size_t getUpdateInterval(float distance) const;
+};
\ No newline at end of file
@@ -9,33 +9,62 @@ InversePalindrome.com
 
 #include "System.hpp"
 #include "Pathway.hpp"
+#include "AIBatch.hpp"
+#include "Perception.hpp"
+#include "AIScheduler.hpp"
+#include "NavigationGraph.hpp"
+
+#include <Box2D/Dynamics/b2World.h>
 
 #include <SFML/System/Vector2.hpp>
 
+#include <vector>
+#include <utility>
 #include <optional>
 
 
 class AISystem : public System
 {
 public:
-    AISystem(Entities& entities, Events& events, Pathways& pathways);
+    AISystem(Entities& entities, Events& events, b2World& world, Pathways& pathways, NavigationGraph& navigationGraph);
 
     virtual void update(float deltaTime) override;
 
+    void setTickRateScale(float tickRateScale);
+    void setAgentBudget(std::size_t agentBudget);
+
 private:
+    struct BatchedAI
+    {
+        Entity entity;
+        std::size_t firstTarget;
+        std::size_t lastTarget;
+    };
+
     Pathways& pathways;
+    NavigationGraph& navigationGraph;
     Entity targetEntity;
 
-    void updateMovement(Entity entity, PatrolComponent& patrol, const sf::Vector2f& position);
+    AIScheduler scheduler;
+    Perception perception;
+    std::vector<std::pair<std::size_t, Entity>> scheduledAIs;
+
+    AIBatch batch;
+    std::vector<BatchedAI> batchedAIs;
+    PerceivedTargets batchedTargets;
+
+    void addToBatch(Entity entity);
+
+    void updateAI(const BatchedAI& batchedAI);
+    void updatePatrol(Entity entity, PatrolComponent& patrol, IntentComponent& intent, const sf::Vector2f& position, const PerceivedTarget* target);
+    void updateRangeAttack(Entity entity, RangeAttackComponent& rangeAttack, TimerComponent& timer, const PerceivedTarget* target);
+    void updateMovement(IntentComponent& intent, const sf::Vector2f& position, const sf::Vector2f& destination);
 
     void addProperties(Entity entity);
 
     void changeWaypoint(Entity entity);
-    void chaseTarget(PatrolComponent& patrol, const sf::Vector2f& AIPosition, const sf::Vector2f& targetPosition);
+    bool chaseTarget(Entity entity, IntentComponent& intent, const sf::Vector2f& AIPosition, const sf::Vector2f& targetPosition);
 
-    std::optional<Pathway> getPathway(Entity entity);
+    std::optional<std::size_t> getPathwayIndex(Entity entity);
     std::optional<sf::Vector2f> getTargetPosition();
-
-    bool isWithinRange(Entity AI, const sf::Vector2f& AIPosition, const sf::Vector2f& targetPosition, float visionRange);
-    bool isFacingTarget(Entity entity);
 };
\ No newline at end of file
@@ -11,6 +11,7 @@ InversePalindrome.com
 #include "Achievement.hpp"
 #include "ResourceManager.hpp"
 #include "Callbacks.hpp"
+#include "FrameSnapshot.hpp"
 
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Sprite.hpp>
@@ -27,6 +28,8 @@ public:
 
     void update();
 
+    void capture(FrameSnapshot& snapshot) const;
+
 private:
     sf::Text text;
     sf::Sprite background;
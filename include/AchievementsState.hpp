@@ -30,6 +30,7 @@ public:
 
     virtual bool isTransparent() const override;
     virtual bool isDependent() const override;
+    virtual bool isIdle() const override;
 
 private:
     sfg::Button::Ptr backButton;
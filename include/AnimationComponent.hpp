@@ -15,6 +15,7 @@ InversePalindrome.com
 
 #include <SFML/Graphics/Sprite.hpp>
 
+#include <vector>
 #include <unordered_map>
 
 
@@ -36,10 +37,17 @@ public:
     bool isPlayingAnimation() const;
     bool hasAnimation(const Animation& animation) const;
 
+    const std::vector<sf::IntRect>& getFrames() const;
+    float getUpdateTime() const;
+
+    void setUpdateTime(float updateTime);
+
 private:
     std::string animationsFile;
     Animator animator;
     Animations animations;
+    std::vector<sf::IntRect> frames;
+    float updateTime;
 };
 
 std::ostream& operator<<(std::ostream& os, const AnimationComponent& component);
\ No newline at end of file
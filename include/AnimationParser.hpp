@@ -9,10 +9,14 @@ InversePalindrome.com
 
 #include "Animation.hpp"
 
+#include <SFML/Graphics/Rect.hpp>
+
 #include <string>
+#include <vector>
 
 
 namespace Parsers
 {
     Animations parseAnimations(const std::string& fileName, Animator& Animator);
+    std::vector<sf::IntRect> parseAnimationFrames(const std::string& fileName);
 }
\ No newline at end of file
@@ -9,20 +9,35 @@ InversePalindrome.com
 
 #include "System.hpp"
 #include "Animation.hpp"
+#include "RenderSystem.hpp"
 
-#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <vector>
 
 
 class AnimatorSystem : public System
 {
 public:
-    AnimatorSystem(Entities& entities, Events& events);
+    AnimatorSystem(Entities& entities, Events& events, const RenderSystem& renderSystem, const sf::FloatRect& activeRegion);
 
     virtual void update(float deltaTime) override;
 
-    void animate(sf::RenderTarget& target);
+    void animate(const sf::View& view);
+
+    void setLODDistance(float lodDistance);
 
 private:
+    const RenderSystem& renderSystem;
+    const sf::FloatRect& activeRegion;
+    std::vector<Entity> visibleEntities;
+    float lodDistance;
+    std::size_t frameCount;
+
+    bool isAnimationDue(Entity entity, const sf::Vector2f& center) const;
+
+    void updateAnimation(AnimationComponent& animation);
+
     void playAnimation(Entity entity, const Animation& animation, bool loop);
     void stopAnimation(Entity entity);
 
@@ -30,4 +45,5 @@ private:
     void changeAnimationDirection(Entity entity, Direction direction);
 
     void playStartingAnimation(Entity entity, AnimationComponent& animation);
+    void packAnimationFrames(Entity entity);
 };
\ No newline at end of file
@@ -14,11 +14,18 @@ InversePalindrome.com
 #include "ResourceManager.hpp"
 #include "SoundManager.hpp"
 #include "GUIManager.hpp"
+#include "GraphicsProperties.hpp"
+#include "RenderThread.hpp"
+#include "FramePacer.hpp"
+#include "QualityGovernor.hpp"
 
+#include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 
+#include <mutex>
 #include <vector>
 #include <string>
+#include <functional>
 
 
 class Application
@@ -39,14 +46,29 @@ private:
     SoundManager soundManager;
     GUIManager guiManager;
 
+    GraphicsProperties graphicsProperties;
+
     sf::RenderWindow window;
+    RenderThread renderThread;
 
     StateData stateData;
     StateMachine stateMachine;
 
+    FramePacer framePacer;
+    QualityGovernor qualityGovernor;
+    std::size_t pendingRedraws;
+
+    sf::Text statisticsText;
+    std::size_t statisticsFrame;
+    std::string statisticsSummary;
+    std::mutex statisticsMutex;
+
     void handleEvents();
     void update(float deltaTime);
     void render();
+    void presentFrame(const std::function<void()>& drawFrame, const sf::Text& statisticsText);
+    void renderStatistics(const sf::Text& statisticsText);
+    sf::Text updateStatisticsText();
 
-    void loadGames(const std::string& fileName);
+    bool isIdleFrame();
 };
\ No newline at end of file
@@ -8,34 +8,30 @@ InversePalindrome.com
 #pragma once
 
 #include "Component.hpp"
-#include "Direction.hpp"
+#include "KinematicPath.hpp"
 
 #include <Box2D/Common/b2Math.h>
 
-#include <vector>
 #include <string>
 
 
 class AutomatedComponent : public Component
 {
     friend std::ostream& operator<<(std::ostream& os, const AutomatedComponent& component);
-    using Task = std::pair<Direction, b2Vec2>;
 
 public:
     AutomatedComponent();
 
-    void loadTasks(const std::string& fileName);
+    void loadPath(const std::string& fileName, const b2Vec2& origin, const b2Vec2& halfExtent, const b2Vec2& maxVelocity);
 
-    void pushNextTask();
+    b2Vec2 advance(float timeStep);
 
-    Task getCurrentTask() const;
-
-    bool hasTasks() const;
+    bool hasPath() const;
 
 private:
-    std::vector<Task> tasks;
+    KinematicPath path;
 
-    std::size_t taskIndex;
+    float elapsedTime;
 };
 
 std::ostream& operator<<(std::ostream& os, const AutomatedComponent& component);
\ No newline at end of file
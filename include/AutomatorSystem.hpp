@@ -9,9 +9,6 @@ InversePalindrome.com
 
 #include "System.hpp"
 
-#include <functional>
-#include <unordered_map>
-
 
 class AutomatorSystem : public System
 {
@@ -21,11 +18,5 @@ public:
     virtual void update(float deltaTime) override;
 
 private:
-    std::unordered_map<Direction, std::function<void(Entity)>> registeredTasks;
-
-    void addTasks(Entity entity);
-
-    void sendTask(Entity entity, AutomatedComponent& automated);
-
-    bool hasCompletedTask(Entity entity, const b2Vec2& target) const;
+    void addPath(Entity entity);
 };
\ No newline at end of file
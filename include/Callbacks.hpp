@@ -7,11 +7,11 @@ InversePalindrome.com
 
 #pragma once
 
+#include "SimulationTimer.hpp"
+
 #include <list>
 #include <functional>
 
-#include <Thor/Time/CallbackTimer.hpp>
-
 
 class Callbacks
 {
@@ -27,6 +27,12 @@ public:
     void disconnectCallbackTimers();
 
 private:
+    struct CallbackTimer
+    {
+        SimulationTimer timer;
+        std::function<void()> callback;
+    };
+
     std::list<std::function<void()>> callbacks;
-    std::list<thor::CallbackTimer> callbackTimers;
+    std::list<CallbackTimer> callbackTimers;
 };
@@ -8,10 +8,12 @@ InversePalindrome.com
 #pragma once
 
 #include "ChunkTiles.hpp"
+#include "ShaderChunkTiles.hpp"
 
 #include <tmxlite/Tileset.hpp>
 #include <tmxlite/TileLayer.hpp>
 
+#include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
@@ -29,12 +31,12 @@ class Chunk : public sf::Transformable, public sf::Drawable
 
 public:
     Chunk(const tmx::TileLayer& layer, std::vector<const tmx::Tileset*> tilesets,
-        const sf::Vector2f& position, const sf::Vector2f& tileCount, std::size_t rowSize, Textures& textureResource);
+        const sf::Vector2f& position, const sf::Vector2f& tileCount, std::size_t rowSize, Textures& textureResource, sf::Shader* tileShader);
 
     bool isEmpty() const;
 
 private:
-    std::vector<std::unique_ptr<ChunkTiles>> chunkTilesContainer;
+    std::vector<std::unique_ptr<sf::Drawable>> chunkTilesContainer;
 
     void draw(sf::RenderTarget& rt, sf::RenderStates states) const override;
 };
@@ -10,6 +10,7 @@ InversePalindrome.com
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
 
@@ -26,12 +27,14 @@ public:
     ChunkTiles(const sf::Texture& texture);
 
     void addTile(const Tile& tile);
+    void upload();
 
     sf::Vector2u getTextureSize() const;
 
 private:
     const sf::Texture& texture;
     std::vector<sf::Vertex> vertices;
+    sf::VertexBuffer vertexBuffer;
 
     void draw(sf::RenderTarget& renderTarget, sf::RenderStates states) const override;
 };
\ No newline at end of file
@@ -10,6 +10,8 @@ InversePalindrome.com
 #include "ResourceManager.hpp"
 #include "Renderable.hpp"
 #include "Animation.hpp"
+#include "SpriteBatch.hpp"
+#include "FrameSnapshot.hpp"
 
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Sprite.hpp>
@@ -30,6 +32,9 @@ public:
 
     void setNumberOfCoins(std::size_t coins);
 
+    void captureStatic(FrameSnapshot& snapshot) const;
+    void batchAnimations(SpriteBatch& spriteBatch) const;
+
 private:
     sf::Sprite coin;
     sf::Text text;
@@ -25,6 +25,8 @@ class CollisionFilter : public b2ContactFilter
 public:
     CollisionFilter(Events& events);
 
+    bool shouldCollide(ObjectType objectA, ObjectType objectB) const;
+
 private:
     Events& events;
     std::unordered_set<std::pair<ObjectType, ObjectType>, boost::hash<std::pair<ObjectType, ObjectType>>> collisionTypes;
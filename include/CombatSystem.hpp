@@ -10,36 +10,52 @@ InversePalindrome.com
 #include "System.hpp"
 #include "Callbacks.hpp"
 #include "ComponentParser.hpp"
+#include "ProjectileSystem.hpp"
 
-#include <Thor/Time/CallbackTimer.hpp>
+#include <Box2D/Dynamics/b2World.h>
+#include <Box2D/Dynamics/b2WorldCallbacks.h>
 
+#include <string>
+#include <vector>
+#include <unordered_map>
 
-class CombatSystem : public System
+
+class CombatSystem : public System, public b2QueryCallback
 {
 public:
-    CombatSystem(Entities& entities, Events& events, ComponentParser& componentParser);
+    CombatSystem(Entities& entities, Events& events, b2World& world, ComponentParser& componentParser, ProjectileSystem& projectileSystem);
 
     virtual void update(float deltaTime) override;
 
 private:
     Callbacks callbacks;
+    b2World& world;
     ComponentParser& componentParser;
+    ProjectileSystem& projectileSystem;
     Entity targetEntity;
 
-    void handleCombat(Entity attacker, Entity victim);
+    b2Vec2 blastCenter;
+    float blastRadius;
+    std::vector<const b2Body*> blastBodies;
+    std::vector<Entity> blastVictims;
+    std::unordered_map<std::string, float> blastRadii;
+
+    void handleCombat(Entity attacker, Entity victim, std::optional<std::int32_t> damagePoints);
     void handleExplosion(Entity bomb, Entity explosion);
 
     void shootProjectile(Entity shooter, const std::string& projectileID);
-    void shootBullet(const PhysicsComponent& shooterPhysics, BulletComponent& bulletComponent, PhysicsComponent& physicsComponent, SpriteComponent& spriteComponent);
     void shootBomb(const PhysicsComponent& shooterPhysics, PhysicsComponent& physicsComponent);
 
     void addReloadTimer(Entity entity);
     void addExplosion(Entity bomb);
 
     void applyKnockback(Entity attacker, Entity victim);
-    void applyBlastImpact(Entity explosion, Entity victim);
+    void applyBlastImpact(Entity bomb, float radius);
 
     sf::Vector2f getProjectileOffset(Entity entity);
+    float getBlastRadius(const std::string& explosionID);
 
     bool canShoot(Entity entity);
+
+    virtual bool ReportFixture(b2Fixture* fixture) override;
 };
\ No newline at end of file
@@ -12,9 +12,13 @@ InversePalindrome.com
 
 #include <box2d/Dynamics/b2World.h>
 
+#include <SFML/Graphics/Sprite.hpp>
+
 #include <string>
 #include <sstream>
+#include <optional>
 #include <functional>
+#include <unordered_set>
 #include <unordered_map>
 
 
@@ -24,32 +28,40 @@ public:
     ComponentParser(Entities& entities, ResourceManager& resourceManager, b2World& world);
 
     Entity parseEntity(std::int32_t entityType, const std::string& fileName);
+    Entity parseEntity(std::int32_t entityType, const std::string& fileName, const std::unordered_set<std::string>& excludedComponents);
 
     void parseBlueprint(const std::string& fileName);
     void parseEntities(const std::string& fileName);
 
     void copyBlueprint(const std::string& fileName, const std::string& copiedFileName);
 
+    std::unordered_map<std::string, std::string> parseFields(const std::string& fileName) const;
+    std::optional<sf::Sprite> parseSprite(const std::unordered_map<std::string, std::string>& fields);
+
+    template <typename... Args>
+    std::tuple<Args...> parse(const std::string& str);
+
 private:
     Entities& entities;
+    ResourceManager& resourceManager;
     b2World& world;
 
     std::int32_t currentEntityID;
     std::unordered_map<std::string, std::function<void(Entity&, const std::string&)>> componentParsers;
 
     Entity createEntity();
-    Entity parseComponents(std::int32_t entityID, const std::string& fileName);
+    Entity parseComponents(std::int32_t entityID, const std::string& fileName, const std::unordered_set<std::string>& excludedComponents);
 
     void setComponentsID(Entity entity, std::int32_t entityID);
 
+    std::string parseComponentName(std::string& line) const;
+    SpriteComponent parseSprite(const std::string& componentName, const std::string& line);
+
     template <typename T>
     std::tuple<T> parse(std::istream& iStream);
 
     template <typename T, typename Arg, typename... Args>
     std::tuple<T, Arg, Args...> parse(std::istream& iStream);
-
-    template <typename... Args>
-    std::tuple<Args...> parse(const std::string& str);
 };
 
 template <typename T>
@@ -12,6 +12,7 @@ InversePalindrome.com
 #include "SpriteComponent.hpp"
 #include "Renderable.hpp"
 #include "ResourceManager.hpp"
+#include "FrameSnapshot.hpp"
 
 #include <string>
 #include <vector>
@@ -36,6 +37,8 @@ public:
     bool isVisible() const;
     bool hasDialogueFinished() const;
 
+    void capture(FrameSnapshot& snapshot, sf::RenderStates states = sf::RenderStates::Default) const;
+
 private:
     float dialogueTime;
     std::string dialogue;
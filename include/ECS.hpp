@@ -16,7 +16,6 @@ InversePalindrome.com
 #include "HealthComponent.hpp"
 #include "MeleeAttackComponent.hpp"
 #include "RangeAttackComponent.hpp"
-#include "BulletComponent.hpp"
 #include "BombComponent.hpp"
 #include "AnimationComponent.hpp"
 #include "ParticleComponent.hpp"
@@ -33,6 +32,7 @@ InversePalindrome.com
 #include "LockComponent.hpp"
 #include "KeyComponent.hpp"
 #include "DialogComponent.hpp"
+#include "IntentComponent.hpp"
 #include "Direction.hpp"
 #include "Achievement.hpp"
 #include "Animation.hpp"
@@ -42,6 +42,8 @@ InversePalindrome.com
 #include <entityplus/entity.h>
 #include <entityplus/event.h>
 
+#include <optional>
+
 
 struct AI;
 struct Turret;
@@ -77,7 +79,6 @@ struct ActivateBomb;
 struct CreateTransform;
 struct ApplyForce;
 struct ApplyImpulse;
-struct ApplyBlastImpact;
 struct ApplyKnockback;
 struct SetUserData;
 struct SetGravityScale;
@@ -95,9 +96,9 @@ struct AddedUserData;
 struct ManageCollision;
 
 using Components = entityplus::component_list<PositionComponent, StateComponent, PhysicsComponent, PatrolComponent, TimerComponent,
-    HealthComponent, MeleeAttackComponent, RangeAttackComponent, BulletComponent, BombComponent, SpriteComponent, TextComponent,
+    HealthComponent, MeleeAttackComponent, RangeAttackComponent, BombComponent, SpriteComponent, TextComponent,
     AnimationComponent, ParticleComponent, ParentComponent, ChildComponent, AutomatedComponent, ControllableComponent, ChaseComponent,
-    PickupComponent, PowerUpComponent, DropComponent, InventoryComponent, LockComponent, KeyComponent, DialogComponent>;
+    PickupComponent, PowerUpComponent, DropComponent, InventoryComponent, LockComponent, KeyComponent, DialogComponent, IntentComponent>;
 
 using Tags = entityplus::tag_list<AI, Turret>;
 
@@ -106,15 +107,15 @@ using Entities = entityplus::entity_manager<Components, Tags>;
 using Events = entityplus::event_manager<Components, Tags, CreateEntity, DestroyBody, UpdateAchievement, UpdateConversation, ChangeDirection, DirectionChanged,
     Jumped, StopMovement, StopSound, StopAnimation, CombatOcurred, ChangeState, StateChanged, ChangeLevel, DestroyEntity, PlaySound, PlayAnimation, PickedUpItem,
     DroppedItem, DisplayHealthBar, DisplayCoins, DisplayPowerUp, DisplayConversation, HidePowerUp, CrossedCheckpoint, CrossedWaypoint, ShootProjectile, ActivateBomb,
-    CreateTransform, ApplyForce, ApplyImpulse, ApplyBlastImpact, ApplyKnockback, SetUserData, SetGravityScale, SetLinearDamping, SetVelocity, SetPosition, SetAngle,
+    CreateTransform, ApplyForce, ApplyImpulse, ApplyKnockback, SetUserData, SetGravityScale, SetLinearDamping, SetVelocity, SetPosition, SetAngle,
     SetMidAirStatus, SetUnderWaterStatus, SetFriction, AddUnderWaterTimer, RemoveUnderWaterTimer, PropelFromWater, AddedUserData, ManageCollision>;
 
 using Entity = Entities::entity_t;
 
 using ComponentList = brigand::list<PositionComponent, StateComponent, PhysicsComponent, PatrolComponent, TimerComponent,
-    HealthComponent, MeleeAttackComponent, RangeAttackComponent, BulletComponent, BombComponent, SpriteComponent, TextComponent,
+    HealthComponent, MeleeAttackComponent, RangeAttackComponent, BombComponent, SpriteComponent, TextComponent,
     AnimationComponent, ParticleComponent, ParentComponent, ChildComponent, AutomatedComponent, ControllableComponent, ChaseComponent,
-    PickupComponent, PowerUpComponent, DropComponent, InventoryComponent, LockComponent, KeyComponent, DialogComponent>;
+    PickupComponent, PowerUpComponent, DropComponent, InventoryComponent, LockComponent, KeyComponent, DialogComponent, IntentComponent>;
 
 struct CreateEntity
 {
@@ -174,6 +175,7 @@ struct CombatOcurred
 {
     Entity attacker;
     Entity victim;
+    std::optional<std::int32_t> damagePoints;
 };
 
 struct ChangeState
@@ -292,12 +294,6 @@ struct ApplyImpulse
     b2Vec2 impulse;
 };
 
-struct ApplyBlastImpact
-{
-    Entity explosion;
-    Entity victim;
-};
-
 struct ApplyKnockback
 {
     Entity attacker;
@@ -8,17 +8,17 @@ InversePalindrome.com
 #pragma once
 
 #include "ResourceManager.hpp"
+#include "ParticleEngine.hpp"
 
 #include <Thor/Particles/Emitters.hpp>
-#include <Thor/Particles/ParticleSystem.hpp>
-#include <Thor/Animations/ColorAnimation.hpp>
+#include <Thor/Graphics/ColorGradient.hpp>
 
 #include <string>
 
 
 namespace Parsers
 {
-    void parseParticleSystem(ResourceManager& resourceManager, const std::string& fileName, thor::ParticleSystem& particleSystem);
+    ParticleProperties parseParticleProperties(ResourceManager& resourceManager, const std::string& fileName);
     thor::UniversalEmitter parseEmitter(const std::string& fileName);
 
     thor::ColorGradient parseColors(const std::string& fileName);
@@ -8,12 +8,32 @@ InversePalindrome.com
 #pragma once
 
 #include "System.hpp"
+#include "FrameSnapshot.hpp"
+#include "ParticleEngine.hpp"
+#include "ResourceManager.hpp"
 
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
 
-class EffectsSystem : public System
+
+class EffectsSystem : public System, public sf::Drawable
 {
 public:
-    EffectsSystem(Entities& entities, Events& events);
+    EffectsSystem(Entities& entities, Events& events, ResourceManager& resourceManager, const sf::FloatRect& activeRegion);
 
     virtual void update(float deltaTime) override;
+
+    void clearParticles();
+
+    void setEmissionScale(float emissionScale);
+
+    void capture(FrameSnapshot& snapshot) const;
+
+private:
+    const sf::FloatRect& activeRegion;
+    ParticleEngine particleEngine;
+
+    virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 };
\ No newline at end of file
@@ -10,17 +10,22 @@ InversePalindrome.com
 #include "ECS.hpp"
 #include "System.hpp"
 #include "Pathway.hpp"
+#include "NavigationGraph.hpp"
 #include "InputHandler.hpp"
 #include "CollisionData.hpp"
+#include "CollisionFilter.hpp"
 #include "ResourceManager.hpp"
 #include "SoundManager.hpp"
 #include "ComponentParser.hpp"
 #include "ComponentSerializer.hpp"
+#include "FrameSnapshot.hpp"
 
 #include <Box2D/Dynamics/b2World.h>
 
 #include <brigand/sequences/map.hpp>
 
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/View.hpp>
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
@@ -35,7 +40,7 @@ class EntityManager : public sf::Drawable
 {
 public:
     EntityManager(b2World& world, ResourceManager& resourceManager, SoundManager& soundManager,
-        InputHandler& inputHandler, CollisionsData& collisionsData, Pathways& pathways);
+        InputHandler& inputHandler, CollisionsData& collisionsData, CollisionFilter& collisionFilter, Pathways& pathways, NavigationGraph& navigationGraph);
     EntityManager(const EntityManager& entityManager) = delete;
     EntityManager& operator=(const EntityManager& entityManager) = delete;
 
@@ -63,11 +68,16 @@ public:
 
     void saveEntities(const std::string& fileName);
 
+    void setActiveRegion(const sf::FloatRect& activeRegion);
+
+    void capture(FrameSnapshot& snapshot, const sf::View& view);
+
 private:
     Entities entityManager;
     Events eventManager;
 
     b2World& world;
+    sf::FloatRect activeRegion;
 
     ComponentParser componentParser;
     ComponentSerializer componentSerializer;
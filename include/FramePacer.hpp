@@ -0,0 +1,49 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - FramePacer.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <cstddef>
+
+
+class FramePacer
+{
+    using Clock = std::chrono::steady_clock;
+
+public:
+    FramePacer();
+
+    void setFrameRateLimit(unsigned frameRateLimit);
+
+    void endFrame();
+    void idle();
+
+    float getWorkTime() const;
+    float getAverageFrameTime() const;
+    float getJitter() const;
+    float getWorstDeviation() const;
+
+    std::string getSummary() const;
+
+private:
+    Clock::duration framePeriod;
+    Clock::time_point nextFrame;
+    Clock::time_point lastFrame;
+
+    std::array<float, 120u> frameTimes;
+    std::size_t frameCount;
+    float workTime;
+    bool isTiming;
+
+    void waitUntil(Clock::time_point time) const;
+    void recordFrame(Clock::time_point time);
+
+    std::size_t getSampleCount() const;
+};
\ No newline at end of file
@@ -0,0 +1,16 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - FramePacing.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include <cstddef>
+
+
+enum class FramePacing : std::size_t
+{
+    Unlimited, VSync, Capped
+};
\ No newline at end of file
@@ -0,0 +1,67 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - FrameSnapshot.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include "GlyphCache.hpp"
+#include "RenderStatistics.hpp"
+
+#include <SFML/Graphics/View.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+
+#include <vector>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+
+class FrameSnapshot : public sf::Drawable
+{
+public:
+    void clear();
+
+    bool isEmpty() const;
+
+    void setView(const sf::View& view);
+    void setCaller(std::string_view caller);
+
+    template<typename T>
+    void add(const T& drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+    void addShared(const sf::Drawable& drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+    void addCommand(std::function<void(sf::RenderTarget&)> command);
+
+private:
+    std::vector<std::function<void(sf::RenderTarget&)>> commands;
+
+    virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+};
+
+
+template<typename T>
+void FrameSnapshot::add(const T& drawable, const sf::RenderStates& states)
+{
+    if constexpr (std::is_same_v<T, sf::Text>)
+    {
+        // Loads the glyphs behind the render fence so the font cache is never written while the render thread reads it
+        Rendering::glyphCache.prepare(drawable);
+        drawable.getLocalBounds();
+    }
+
+    this->commands.push_back([drawable, states](sf::RenderTarget& target)
+    {
+        target.draw(drawable, states);
+
+        if constexpr (std::is_same_v<T, sf::Sprite> || std::is_same_v<T, sf::Text>)
+        {
+            Statistics::renderStatistics.recordDraw(drawable, states);
+        }
+    });
+}
\ No newline at end of file
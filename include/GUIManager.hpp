@@ -35,6 +35,8 @@ public:
 
     void hideAllWidgets();
 
+    bool hasVisibleWidgets() const;
+
     template<typename T>
     void setProperty(const std::string& selector, const std::string& property, const T& value);
 
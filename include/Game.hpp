@@ -17,6 +17,7 @@ InversePalindrome.com
 
 #include <cstddef>
 #include <string>
+#include <vector>
 #include <ostream>
 #include <optional>
 #include <unordered_map>
@@ -73,3 +74,5 @@ private:
 };
 
 std::ostream& operator<<(std::ostream& os, const Game& game);
+
+std::vector<Game> loadGames(const std::string& fileName);
@@ -20,13 +20,19 @@ InversePalindrome.com
 #include "PowerUpDisplay.hpp"
 #include "AchievementDisplay.hpp"
 #include "UnderWaterDisplay.hpp"
+#include "HUDCache.hpp"
+#include "FrameSnapshot.hpp"
+#include "ResolutionScaler.hpp"
 #include "Pathway.hpp"
+#include "NavigationGraph.hpp"
 
 #include <Box2D/Dynamics/b2World.h>
 
 #include <SFML/Graphics/View.hpp>
 
 #include <memory>
+#include <algorithm>
+#include <functional>
 
 
 class GameState : public State
@@ -37,6 +43,7 @@ public:
     virtual void handleEvent(const sf::Event& event) override;
     virtual void update(float deltaTime) override;
     virtual void draw() override;
+    virtual bool capture(FrameSnapshot& snapshot) override;
 
     virtual void showWidgets(bool showStatus) override;
 
@@ -50,6 +57,7 @@ private:
     sf::View camera;
     Callbacks callbacks;
     Pathways pathways;
+    NavigationGraph navigationGraph;
 
     CollisionHandler collisionHandler;
     CollisionFilter collisionFilter;
@@ -60,13 +68,29 @@ private:
     PowerUpDisplay powerUpDisplay;
     UnderWaterDisplay underWaterDisplay;
     AchievementDisplay achievementDisplay;
-
+    HUDCache hudCache;
+    ResolutionScaler resolutionScaler;
+    std::shared_ptr<FrameSnapshot> hudLayer;
+    std::size_t hudVersion;
+    std::size_t cachedHUDVersion;
+    bool hudDirty;
+    float accumulatedTime;
+
+    void step(float timeStep);
     void updateCamera();
+    void applyQualitySettings();
+    void drawWorld(sf::RenderTarget& target, const sf::View& view, float renderScale, const std::function<void(sf::RenderTarget&)>& drawScene);
+    void invalidateHUD();
+    void updateHUDLayer();
+    void captureHUD(FrameSnapshot& snapshot) const;
+    void batchHUDAnimations(SpriteBatch& animations) const;
+    void drawHUD(sf::RenderTarget& target, const FrameSnapshot& layer, std::size_t version, SpriteBatch animations);
     void updateAchievements(Achievement achievement);
     void updateHealthBar(const HealthComponent& health);
     void updateCoinDisplay();
     void updateItemsDisplay(Entity item);
     void updateConversationDisplay(Entity entity);
+    void updateUnderWaterDisplay(std::size_t numberOfBubbles);
 
     void displayConversation(Entity entity, bool visibilityStatus);
 
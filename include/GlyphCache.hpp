@@ -0,0 +1,34 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - GlyphCache.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+#include <map>
+#include <tuple>
+#include <functional>
+#include <unordered_set>
+
+
+class GlyphCache
+{
+public:
+    void setLoadingFence(std::function<void()> loadingFence);
+
+    void prepare(const sf::Text& text);
+
+private:
+    std::map<std::tuple<const sf::Font*, unsigned, bool, float>, std::unordered_set<sf::Uint32>> preparedGlyphs;
+    std::function<void()> loadingFence;
+};
+
+namespace Rendering
+{
+    extern GlyphCache glyphCache;
+}
\ No newline at end of file
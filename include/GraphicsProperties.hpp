@@ -0,0 +1,35 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - GraphicsProperties.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include "TileRenderMode.hpp"
+#include "FramePacing.hpp"
+
+#include <string>
+#include <cstddef>
+
+
+struct GraphicsProperties
+{
+    GraphicsProperties(const std::string& fileName);
+
+    void saveData(const std::string& fileName) const;
+
+    TileRenderMode tileRenderMode;
+    std::size_t layerPagesMemory;
+    bool showRenderStatistics;
+    bool threadedRendering;
+    FramePacing framePacing;
+    unsigned frameRateLimit;
+    bool idleRedraw;
+    bool adaptiveQuality;
+    float renderScale;
+    float particleDensity;
+    float animationLODDistance;
+    float aiTickRate;
+};
\ No newline at end of file
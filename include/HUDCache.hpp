@@ -0,0 +1,43 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - HUDCache.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include "SpriteBatch.hpp"
+
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <memory>
+#include <functional>
+
+
+class HUDCache : public sf::Drawable
+{
+public:
+    HUDCache();
+
+    bool render(const sf::Vector2u& size, const std::function<void(sf::RenderTarget&)>& drawStatic);
+
+    void invalidate();
+
+    bool isValid() const;
+
+    SpriteBatch& getAnimations();
+
+private:
+    std::unique_ptr<sf::RenderTexture> renderTexture;
+    sf::Sprite sprite;
+    sf::Vector2u failedSize;
+    SpriteBatch animations;
+    bool valid;
+
+    virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+};
\ No newline at end of file
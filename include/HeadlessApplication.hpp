@@ -0,0 +1,54 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - HeadlessApplication.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include "Game.hpp"
+#include "StateData.hpp"
+#include "StateMachine.hpp"
+#include "InputHandler.hpp"
+#include "InputScript.hpp"
+#include "ResourceManager.hpp"
+#include "NullSoundManager.hpp"
+#include "GraphicsProperties.hpp"
+#include "RenderThread.hpp"
+
+#include <SFML/Graphics/RenderWindow.hpp>
+
+#include <vector>
+#include <string>
+#include <cstddef>
+
+
+class HeadlessApplication
+{
+public:
+    HeadlessApplication(const std::string& gameName, const std::string& level, const std::string& scriptFile);
+    HeadlessApplication(const HeadlessApplication& application) = delete;
+    HeadlessApplication& operator=(const HeadlessApplication& application) = delete;
+
+    bool run(std::size_t ticks);
+
+private:
+    std::vector<Game> games;
+
+    InputHandler inputHandler;
+    InputScript inputScript;
+
+    ResourceManager resourceManager;
+    NullSoundManager soundManager;
+
+    GraphicsProperties graphicsProperties;
+
+    sf::RenderWindow window;
+    RenderThread renderThread;
+
+    StateData stateData;
+    StateMachine stateMachine;
+
+    bool selectGame(const std::string& gameName, const std::string& level);
+};
\ No newline at end of file
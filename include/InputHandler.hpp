@@ -13,6 +13,8 @@ InversePalindrome.com
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Window.hpp>
 
+#include <vector>
+#include <optional>
 #include <unordered_map>
 
 
@@ -40,6 +42,8 @@ public:
 
     void changeKey(Action action, sf::Keyboard::Key key);
 
+    void setScriptedActions(const std::vector<Action>& actions);
+
     void clearEvents();
     void clearCallbacks();
 
@@ -50,4 +54,5 @@ private:
     thor::ActionMap<Action>::CallbackSystem keyCallbacks;
 
     std::unordered_map<Action, std::pair<std::size_t, std::size_t>> keyCodes;
+    std::optional<std::vector<Action>> scriptedActions;
 };
\ No newline at end of file
@@ -0,0 +1,36 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - InputScript.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include "InputHandler.hpp"
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+
+class InputScript
+{
+public:
+    InputScript();
+    explicit InputScript(const std::string& fileName);
+
+    void loadScript(const std::string& fileName);
+
+    std::vector<Action> getActions(std::size_t tick) const;
+
+private:
+    struct ScriptedAction
+    {
+        std::size_t firstTick;
+        std::size_t lastTick;
+        Action action;
+    };
+
+    std::vector<ScriptedAction> scriptedActions;
+};
\ No newline at end of file
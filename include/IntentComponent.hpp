@@ -0,0 +1,36 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - IntentComponent.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include "Component.hpp"
+#include "Direction.hpp"
+
+
+class IntentComponent : public Component
+{
+    friend std::ostream& operator<<(std::ostream& os, const IntentComponent& component);
+
+public:
+    IntentComponent();
+
+    Direction getDirection() const;
+
+    void setDirection(Direction direction);
+    void setMovementStatus(bool movementStatus);
+    void setJumpStatus(bool jumpStatus);
+
+    bool isMoving() const;
+    bool isJumping() const;
+
+private:
+    Direction direction;
+    bool movementStatus;
+    bool jumpStatus;
+};
+
+std::ostream& operator<<(std::ostream& os, const IntentComponent& component);
\ No newline at end of file
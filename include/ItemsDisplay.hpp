@@ -10,6 +10,8 @@ InversePalindrome.com
 #include "Item.hpp"
 #include "Renderable.hpp"
 #include "Animation.hpp"
+#include "SpriteBatch.hpp"
+#include "FrameSnapshot.hpp"
 #include "ResourceManager.hpp"
 
 #include <Thor/Animations/Animator.hpp>
@@ -35,6 +37,11 @@ public:
 
     void update(float deltaTime);
 
+    void captureStatic(FrameSnapshot& snapshot) const;
+    void batchAnimations(SpriteBatch& spriteBatch) const;
+
+    void setQuantity(Item item, std::size_t quantity);
+
     bool getVisibility() const;
 
     void setVisibility(bool isVisible);
@@ -10,9 +10,6 @@ InversePalindrome.com
 #include "System.hpp"
 #include "Callbacks.hpp"
 
-#include <Thor/Time/CallbackTimer.hpp>
-
-#include <vector>
 #include <unordered_map>
 #include <functional>
 
@@ -26,10 +23,10 @@ public:
 
 private:
     std::unordered_map<Item, std::string> itemNames;
-    std::vector<thor::CallbackTimer> powerUpTimers;
     std::unordered_map<Item, std::function<void(Entity, PowerUpComponent&)>> powerUpEffects;
 
     Callbacks callbacks;
+    Callbacks powerUpTimers;
 
     void handleItemPickup(Entity collector, Entity item);
     void handleItemDrop(Entity dropper);
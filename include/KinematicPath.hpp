@@ -0,0 +1,45 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - KinematicPath.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include "Direction.hpp"
+
+#include <Box2D/Common/b2Math.h>
+
+#include <vector>
+#include <utility>
+
+
+struct PathSegment
+{
+    b2Vec2 origin;
+    b2Vec2 velocity;
+    float startTime;
+};
+
+class KinematicPath
+{
+public:
+    using Task = std::pair<Direction, b2Vec2>;
+
+    KinematicPath();
+
+    void compile(const std::vector<Task>& tasks, const b2Vec2& origin, const b2Vec2& halfExtent, const b2Vec2& maxVelocity);
+
+    b2Vec2 getPosition(float time) const;
+    float getDuration() const;
+
+    bool isEmpty() const;
+
+private:
+    std::vector<PathSegment> segments;
+    std::size_t loopIndex;
+    float duration;
+
+    void addSegments(const std::vector<Task>& tasks, const b2Vec2& halfExtent, const b2Vec2& maxVelocity, b2Vec2& position);
+};
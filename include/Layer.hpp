@@ -8,11 +8,13 @@ InversePalindrome.com
 #pragma once
 
 #include "Chunk.hpp"
+#include "TileRenderMode.hpp"
 
 #include <tmxlite/Map.hpp>
 #include <tmxlite/Layer.hpp>
 
 #include <SFML/Graphics/View.hpp>
+#include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/Drawable.hpp>
 
@@ -23,7 +25,7 @@ InversePalindrome.com
 class Layer : public sf::Drawable
 {
 public:
-    Layer(const tmx::Map& map, std::size_t layerID, const sf::Vector2f& layerSize);
+    Layer(const tmx::Map& map, std::size_t layerID, const sf::Vector2f& chunkSize, TileRenderMode renderMode);
 
     const sf::FloatRect& getGlobalBounds() const;
 
@@ -35,6 +37,7 @@ private:
     sf::FloatRect globalBounds;
 
     std::map<std::string, std::unique_ptr<sf::Texture>> textures;
+    std::unique_ptr<sf::Shader> tileShader;
 
     std::vector<std::unique_ptr<Chunk>> chunks;
     mutable std::vector<const Chunk*> visibleChunks;
@@ -0,0 +1,40 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - LayerPages.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include "Layer.hpp"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+
+
+class LayerPages : public sf::Drawable
+{
+public:
+    bool render(const sf::Drawable& background, const std::vector<std::unique_ptr<Layer>>& layers,
+        const sf::FloatRect& bounds, const sf::Vector2f& pageSize, std::size_t memoryLimit);
+
+    void clear();
+
+    bool isRendered() const;
+
+private:
+    sf::Vector2f pageSize;
+    sf::Vector2u pageCount;
+
+    std::vector<std::unique_ptr<sf::RenderTexture>> pages;
+    std::vector<sf::Sprite> pageSprites;
+
+    virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+};
\ No newline at end of file
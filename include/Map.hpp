@@ -8,8 +8,10 @@ InversePalindrome.com
 #pragma once
 
 #include "Layer.hpp"
+#include "LayerPages.hpp"
 #include "Game.hpp"
 #include "Pathway.hpp"
+#include "TileRenderMode.hpp"
 #include "CollisionData.hpp"
 #include "ResourceManager.hpp"
 #include "ComponentSerializer.hpp"
@@ -34,6 +36,11 @@ public:
 
     void load(const std::string& fileName);
 
+    void setChunkSize(const sf::Vector2f& chunkSize);
+    void setTileRenderMode(TileRenderMode tileRenderMode);
+    void setLayerPagesMemory(std::size_t megabytes);
+    void setGraphicsEnabled(bool graphicsEnabled);
+
     sf::FloatRect getBounds() const;
     std::string getCurrentFilePath() const;
 
@@ -41,8 +48,13 @@ private:
     tmx::Map map;
     sf::Sprite background;
     sf::FloatRect bounds;
+    sf::Vector2f chunkSize;
+    TileRenderMode tileRenderMode;
+    std::size_t layerPagesMemory;
+    bool graphicsEnabled;
     std::string fileName;
     std::vector<std::unique_ptr<Layer>> layers;
+    LayerPages layerPages;
 
     Game& game;
     b2World& world;
@@ -53,6 +65,8 @@ private:
 
     void parseMap();
 
+    sf::Vector2f getChunkSize() const;
+
     void addImage(tmx::ImageLayer* imageLayer);
     void addObjects(tmx::ObjectGroup* objectLayer);
 
@@ -9,8 +9,9 @@ InversePalindrome.com
 
 #include "State.hpp"
 #include "StateID.hpp"
+#include "ParticleEngine.hpp"
 
-#include <Thor/Particles/ParticleSystem.hpp>
+#include <Thor/Particles/Emitters.hpp>
 
 #include <SFGUI/Button.hpp>
 
@@ -37,7 +38,9 @@ private:
     sfg::Button::Ptr settingsButton;
     sfg::Button::Ptr quitButton;
 
-    thor::ParticleSystem particleSystem;
+    ParticleEngine particleEngine;
+    thor::UniversalEmitter particleEmitter;
+    std::size_t particlePool;
 
     bool isTitleVisible;
 
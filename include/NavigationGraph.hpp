@@ -0,0 +1,74 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - NavigationGraph.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include <Box2D/Dynamics/b2World.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <map>
+#include <tuple>
+#include <vector>
+#include <cstddef>
+#include <optional>
+
+
+enum class NavigationLinkType : std::size_t
+{
+    Walk, Drop, Jump
+};
+
+struct NavigationSurface
+{
+    float left;
+    float right;
+    float height;
+};
+
+struct NavigationLink
+{
+    std::size_t surface;
+    NavigationLinkType type;
+    sf::Vector2f departure;
+    sf::Vector2f arrival;
+    float cost;
+};
+
+using NavigationPath = std::vector<NavigationLink>;
+
+class NavigationGraph
+{
+public:
+    NavigationGraph(b2World& world);
+
+    const NavigationPath* findPath(const sf::Vector2f& origin, const sf::Vector2f& destination, float jumpVelocity, float maxVelocity);
+
+    std::optional<std::size_t> getSurface(const sf::Vector2f& position);
+
+    void invalidate();
+
+private:
+    using Archetype = std::pair<float, float>;
+    using Links = std::vector<std::vector<NavigationLink>>;
+
+    b2World& world;
+    std::vector<NavigationSurface> surfaces;
+    std::map<Archetype, Links> archetypeLinks;
+    std::map<std::tuple<Archetype, std::size_t, std::size_t>, std::optional<NavigationPath>> cachedPaths;
+
+    bool dirtyStatus;
+
+    void build();
+    void addSurfaces();
+
+    const Links& getLinks(const Archetype& archetype);
+    std::optional<NavigationLink> createLink(std::size_t from, std::size_t to, const Archetype& archetype) const;
+    std::optional<NavigationPath> searchPath(std::size_t origin, std::size_t destination, const Links& links) const;
+
+    float estimateCost(std::size_t from, std::size_t to) const;
+};
\ No newline at end of file
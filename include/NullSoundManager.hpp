@@ -0,0 +1,23 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - NullSoundManager.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include "SoundManager.hpp"
+
+
+class NullSoundManager : public SoundManager
+{
+public:
+    NullSoundManager(ResourceManager& resourceManager);
+
+    virtual void playSound(SoundBuffersID soundBufferID, bool loop) override;
+    virtual void playMusic(const std::string& name, bool loop) override;
+
+    virtual void setListenerPosition(const sf::Vector3f& position) override;
+    virtual void setListenerDirection(const sf::Vector3f& direction) override;
+};
\ No newline at end of file
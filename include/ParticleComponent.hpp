@@ -7,25 +7,27 @@ InversePalindrome.com
 
 #pragma once
 
-#include "Renderable.hpp"
 #include "Component.hpp"
 #include "StateComponent.hpp"
-#include "ResourceManager.hpp"
+#include "ParticleEngine.hpp"
 
-#include <Thor/Particles/ParticleSystem.hpp>
+#include <Thor/Particles/Emitters.hpp>
 
-#include <unordered_map>
+#include <SFML/Graphics/Transformable.hpp>
 
+#include <string>
+#include <cstddef>
+#include <optional>
 
-class ParticleComponent : public Component, public Renderable
+
+class ParticleComponent : public Component, public sf::Transformable
 {
     friend std::ostream& operator<<(std::ostream& os, const ParticleComponent& component);
 
 public:
-    ParticleComponent(ResourceManager& resourceManager, const sf::Vector2f& effectRange,
-        const std::string& particleFile, const std::string& emitterFile);
+    ParticleComponent(const sf::Vector2f& effectRange, const std::string& particleFile, const std::string& emitterFile);
 
-    void update(float deltaTime);
+    void update(ParticleEngine& particleEngine, bool isActive, float deltaTime);
 
     sf::FloatRect getGlobalBounds() const;
 
@@ -34,9 +36,8 @@ private:
     std::string particleFile;
     std::string emitterFile;
 
-    thor::ParticleSystem particleSystem;
-
-    virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+    thor::UniversalEmitter emitter;
+    std::optional<std::size_t> poolIndex;
 };
 
 std::ostream& operator<<(std::ostream& os, const ParticleComponent& component);
\ No newline at end of file
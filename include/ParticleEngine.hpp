@@ -0,0 +1,139 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - ParticleEngine.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include "SpriteBatch.hpp"
+#include "FrameSnapshot.hpp"
+#include "ResourceManager.hpp"
+
+#include <Thor/Particles/Emitters.hpp>
+#include <Thor/Particles/Particle.hpp>
+#include <Thor/Particles/EmissionInterface.hpp>
+#include <Thor/Graphics/ColorGradient.hpp>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <unordered_map>
+
+
+enum class AffectorType : std::size_t
+{
+    Force, Scale, Torque, Fade, Color
+};
+
+struct ParticleAffector
+{
+    AffectorType type;
+    sf::Vector2f values;
+    thor::ColorGradient colors;
+};
+
+struct ParticleProperties
+{
+    const sf::Texture* texture;
+    std::vector<sf::IntRect> textureRects;
+    std::vector<ParticleAffector> affectors;
+};
+
+class ParticleEngine : public sf::Drawable, private thor::EmissionInterface
+{
+public:
+    explicit ParticleEngine(ResourceManager& resourceManager);
+
+    std::size_t getPool(const std::string& particleFile);
+    std::size_t addAnchor(const std::string& particleFile);
+
+    void moveAnchor(std::size_t poolIndex, const sf::Vector2f& position, bool isActive);
+    void releaseStaleAnchors();
+
+    void emit(std::size_t poolIndex, thor::UniversalEmitter& emitter, const sf::Vector2f& position, float deltaTime);
+
+    void update(float deltaTime);
+
+    void clear();
+
+    void setEmissionScale(float emissionScale);
+
+    void capture(FrameSnapshot& snapshot) const;
+
+    std::size_t getParticleCount() const;
+
+private:
+    struct ParticlePool
+    {
+        std::size_t propertiesIndex;
+        sf::Vector2f anchor;
+        std::size_t updateStamp;
+        bool isAnchored;
+        bool isActive;
+        bool isFree;
+
+        std::vector<float> xPositions;
+        std::vector<float> yPositions;
+        std::vector<float> xVelocities;
+        std::vector<float> yVelocities;
+        std::vector<float> rotations;
+        std::vector<float> rotationSpeeds;
+        std::vector<float> xScales;
+        std::vector<float> yScales;
+        std::vector<float> reds;
+        std::vector<float> greens;
+        std::vector<float> blues;
+        std::vector<float> alphas;
+        std::vector<float> elapsedLifetimes;
+        std::vector<float> totalLifetimes;
+        std::vector<std::uint32_t> textureIndices;
+
+        std::size_t size() const;
+    };
+
+    ResourceManager& resourceManager;
+
+    std::vector<ParticleProperties> properties;
+    std::unordered_map<std::string, std::size_t> propertiesIndices;
+    std::vector<ParticlePool> pools;
+    std::unordered_map<std::string, std::size_t> poolIndices;
+    std::vector<std::size_t> freeAnchors;
+    std::vector<float> progresses;
+    SpriteBatch spriteBatch;
+
+    ParticlePool* emittingPool;
+    sf::Vector2f emittingPosition;
+    float emissionScale;
+    std::size_t updateStamp;
+
+    virtual void emitParticle(const thor::Particle& particle) override;
+
+    std::size_t getProperties(const std::string& particleFile);
+    std::size_t addPool(const std::string& particleFile, bool isAnchored);
+    void releaseAnchor(std::size_t poolIndex);
+    void clearPool(ParticlePool& pool);
+
+    void integrate(ParticlePool& pool, float deltaTime);
+    void removeExpired(ParticlePool& pool);
+    void computeProgresses(const ParticlePool& pool);
+
+    void applyAffector(ParticlePool& pool, const ParticleAffector& affector, float deltaTime);
+    void applyFade(ParticlePool& pool, float fadeInRatio, float fadeOutRatio);
+    void applyColors(ParticlePool& pool, const thor::ColorGradient& colors);
+
+    void addScaled(std::vector<float>& values, const std::vector<float>& rates, float deltaTime);
+    void addConstant(std::vector<float>& values, float constant);
+
+    void updateBatches();
+
+    virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+};
\ No newline at end of file
@@ -11,6 +11,7 @@ InversePalindrome.com
 
 #include <vector>
 #include <cstddef>
+#include <optional>
 #include <unordered_map>
 
 
@@ -27,26 +28,39 @@ struct Waypoint
 class Pathway
 {
 public:
-    Pathway();
+    Pathway(const Waypoint* waypoints, std::size_t numberOfWaypoints);
 
-    std::vector<Waypoint> getWaypoints() const;
-    Waypoint getCurrentWaypoint() const;
-    std::size_t getCurrentWaypointIndex() const;
-    std::pair<float, float> getRange() const;
-
-    void setCurrentWaypointIndex(std::size_t currentWaypointIndex);
+    const Waypoint& operator[](std::size_t index) const;
 
-    void moveToNextWaypoint();
-    void addWaypoint(const Waypoint& waypoint);
+    const Waypoint* begin() const;
+    const Waypoint* end() const;
 
-    void sortWaypoints();
+    std::size_t size() const;
+    std::pair<float, float> getRange() const;
 
     bool hasWaypoints() const;
 
 private:
-    std::vector<Waypoint> waypoints;
-    std::size_t currentWaypointIndex;
+    const Waypoint* waypoints;
+    std::size_t numberOfWaypoints;
     std::pair<float, float> range;
 };
 
-using Pathways = std::unordered_map<std::size_t, Pathway>;
\ No newline at end of file
+class Pathways
+{
+public:
+    const Pathway& operator[](std::size_t pathwayIndex) const;
+
+    std::optional<std::size_t> getPathwayIndex(std::size_t pathwayID) const;
+
+    void addWaypoint(std::size_t pathwayID, const Waypoint& waypoint);
+
+    void build();
+    void clear();
+
+private:
+    std::vector<std::pair<std::size_t, Waypoint>> pendingWaypoints;
+    std::vector<Waypoint> waypoints;
+    std::vector<Pathway> pathways;
+    std::unordered_map<std::size_t, std::size_t> pathwayIndices;
+};
\ No newline at end of file
@@ -8,7 +8,9 @@ InversePalindrome.com
 #pragma once
 
 #include "Component.hpp"
-#include "Pathway.hpp"
+
+#include <cstddef>
+#include <optional>
 
 
 class PatrolComponent : public Component
@@ -18,23 +20,20 @@ class PatrolComponent : public Component
 public:
     PatrolComponent();
 
-    Waypoint operator[](std::size_t index);
-
-    Pathway getPathway() const;
-    Waypoint getCurrentWaypoint() const;
+    std::size_t getPathwayIndex() const;
     std::size_t getCurrentWaypointIndex() const;
-    std::pair<float, float> getRange() const;
 
-    void setPathway(const Pathway& pathway);
+    void setPathwayIndex(std::size_t pathwayIndex);
     void setCurrentWaypointIndex(std::size_t currentWaypointIndex);
 
-    void moveToNextWaypoint();
+    void moveToNextWaypoint(std::size_t numberOfWaypoints);
 
-    bool hasWaypoints() const;
+    bool hasPathway() const;
 
 private:
-    Pathway pathway;
+    std::optional<std::size_t> pathwayIndex;
+    std::size_t currentWaypointIndex;
+    bool reversedStatus;
 };
 
 std::ostream& operator<<(std::ostream& os, const PatrolComponent& component);
-
@@ -26,6 +26,7 @@ public:
 
     virtual bool isTransparent() const override;
     virtual void showWidgets(bool showStatus) override;
+    virtual bool isIdle() const override;
 
 private:
     sf::Text title;
@@ -0,0 +1,68 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - Perception.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include "ECS.hpp"
+#include "ObjectType.hpp"
+
+#include <Box2D/Dynamics/b2World.h>
+#include <Box2D/Dynamics/b2WorldCallbacks.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <unordered_map>
+
+
+struct PerceivedTarget
+{
+    Entity entity;
+    sf::Vector2f position;
+    float distance;
+};
+
+using PerceivedTargets = std::vector<PerceivedTarget>;
+
+class Perception : public b2QueryCallback, public b2RayCastCallback
+{
+public:
+    Perception(b2World& world, std::size_t cacheDuration);
+
+    void beginFrame();
+
+    const PerceivedTargets& perceive(std::int32_t observerID, const sf::Vector2f& position, float range, ObjectType targetType);
+
+    bool isInLineOfSight(const sf::Vector2f& origin, const sf::Vector2f& destination);
+
+private:
+    struct CachedPerception
+    {
+        PerceivedTargets targets;
+        std::size_t frame;
+        float range;
+        ObjectType targetType;
+    };
+
+    b2World& world;
+    std::unordered_map<std::int32_t, CachedPerception> cachedPerceptions;
+    std::vector<const b2Body*> candidateBodies;
+    PerceivedTargets candidates;
+
+    std::size_t currentFrame;
+    std::size_t cacheDuration;
+
+    ObjectType queryType;
+    bool occludedStatus;
+
+    void refreshTargets(PerceivedTargets& targets, const sf::Vector2f& position, float range);
+
+    virtual bool ReportFixture(b2Fixture* fixture) override;
+    virtual float32 ReportFixture(b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, float32 fraction) override;
+};
\ No newline at end of file
@@ -28,8 +28,10 @@ private:
     b2World& world;
 
     void moveEntity(Entity entity, Direction direction);
+    void moveEntity(Entity entity, PhysicsComponent& physics, Direction direction);
     void stopEntity(Entity entity);
     void makeJump(Entity entity);
+    void makeJump(Entity entity, PhysicsComponent& physics);
 
     void propelFromWater(Entity entity);
 
@@ -44,6 +46,8 @@ private:
     void applyImpulse(Entity entity, const b2Vec2& impulse);
     void applyForce(Entity entity, const b2Vec2& force);
 
+    void changeState(Entity entity, EntityState state);
+
     void convertPositionCoordinates(const PhysicsComponent& physics, PositionComponent& position);
     void checkPhysicalStatus(Entity entity, PhysicsComponent& physics);
 
@@ -9,6 +9,7 @@ InversePalindrome.com
 
 #include "Item.hpp"
 #include "Animation.hpp"
+#include "SpriteBatch.hpp"
 #include "ResourceManager.hpp"
 
 #include <SFML/Graphics/Sprite.hpp>
@@ -34,6 +35,8 @@ public:
     void removePowerUp(Item powerUp);
     void clearPowerUps();
 
+    void batchAnimations(SpriteBatch& spriteBatch) const;
+
 private:
     std::unordered_map<Item, PowerUpGraphics> powerUps;
     std::unordered_map<Item, PowerUpData> powerUpData;
@@ -0,0 +1,86 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - ProjectileSystem.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include "System.hpp"
+#include "CollisionData.hpp"
+#include "CollisionFilter.hpp"
+#include "SpriteBatch.hpp"
+#include "FrameSnapshot.hpp"
+#include "ComponentParser.hpp"
+
+#include <Box2D/Dynamics/b2World.h>
+#include <Box2D/Dynamics/b2WorldCallbacks.h>
+
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+
+#include <string>
+#include <vector>
+#include <optional>
+#include <unordered_map>
+
+
+class ProjectileSystem : public System, public sf::Drawable, public b2RayCastCallback
+{
+public:
+    ProjectileSystem(Entities& entities, Events& events, b2World& world, ComponentParser& componentParser, CollisionFilter& collisionFilter);
+
+    virtual void update(float deltaTime) override;
+
+    bool shootBullet(Entity shooter, const std::string& projectileID, const sf::Vector2f& position, Direction direction);
+
+    void clearBullets();
+
+    void capture(FrameSnapshot& snapshot) const;
+
+private:
+    struct BulletArchetype
+    {
+        std::int32_t damagePoints;
+        SoundBuffersID soundID;
+        float speed;
+        sf::Sprite sprite;
+    };
+
+    struct Bullet
+    {
+        std::size_t archetype;
+        Entity shooter;
+        std::optional<std::int32_t> shooterID;
+        b2Vec2 position;
+        b2Vec2 velocity;
+        float rotation;
+        float lifeTime;
+    };
+
+    b2World& world;
+    ComponentParser& componentParser;
+    CollisionFilter& collisionFilter;
+
+    std::vector<BulletArchetype> archetypes;
+    std::unordered_map<std::string, std::optional<std::size_t>> archetypeIndices;
+    std::vector<Bullet> bullets;
+    SpriteBatch spriteBatch;
+
+    const Bullet* castingBullet;
+    CollisionData* hitObject;
+
+    std::optional<std::size_t> getArchetype(const std::string& projectileID);
+
+    bool advanceBullet(Bullet& bullet, float timeStep);
+    void handleHit(const Bullet& bullet, CollisionData& object);
+
+    void updateBatches();
+
+    virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+    virtual float32 ReportFixture(b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, float32 fraction) override;
+};
\ No newline at end of file
@@ -0,0 +1,53 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - QualityGovernor.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include "GraphicsProperties.hpp"
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <fstream>
+
+
+struct QualityLevel
+{
+    float renderScale;
+    float particleDensity;
+    float animationLODDistance;
+    float aiTickRate;
+};
+
+class QualityGovernor
+{
+public:
+    explicit QualityGovernor(GraphicsProperties& graphicsProperties);
+
+    void setLogFile(const std::string& fileName);
+
+    void addFrameTime(float frameTime);
+
+    std::size_t getQualityLevel() const;
+
+private:
+    GraphicsProperties& graphicsProperties;
+
+    std::vector<QualityLevel> qualityLevels;
+    std::vector<float> frameTimes;
+    std::ofstream logFile;
+
+    float frameBudget;
+    std::size_t qualityLevel;
+    std::size_t headroomWindows;
+    std::size_t frameCount;
+
+    float getPercentile(float percentile);
+
+    void applyQualityLevel();
+    void logDecision(float medianFrameTime, float tailFrameTime, std::size_t previousLevel);
+};
\ No newline at end of file
@@ -0,0 +1,62 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - RenderGrid.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include "ECS.hpp"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+
+
+class RenderGrid
+{
+public:
+    RenderGrid();
+
+    void setCellSize(const sf::Vector2f& cellSize);
+
+    void beginUpdate();
+    std::size_t update(std::optional<std::size_t> entryIndex, Entity entity, const sf::Vector2f& position, const sf::FloatRect& globalBounds);
+    void endUpdate();
+
+    void query(const sf::FloatRect& area, std::vector<Entity>& entities) const;
+
+private:
+    struct Entry
+    {
+        Entity entity;
+        std::size_t order;
+        sf::Vector2i firstCell;
+        sf::Vector2i lastCell;
+        std::size_t updateStamp;
+        mutable std::size_t queryStamp;
+        bool isActive;
+    };
+
+    sf::Vector2f cellSize;
+    std::size_t entryCount;
+    std::size_t updateStamp;
+    mutable std::size_t queryStamp;
+
+    std::vector<Entry> entries;
+    std::vector<std::size_t> freeEntries;
+    std::unordered_map<std::uint64_t, std::vector<std::size_t>> cells;
+    mutable std::vector<std::size_t> queriedEntries;
+
+    void insertCells(std::size_t entryIndex);
+    void removeCells(std::size_t entryIndex);
+
+    sf::Vector2i getCell(const sf::Vector2f& position) const;
+    std::uint64_t getCellKey(const sf::Vector2i& cell) const;
+};
\ No newline at end of file
@@ -0,0 +1,96 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - RenderStatistics.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <fstream>
+#include <utility>
+#include <optional>
+#include <string_view>
+
+
+struct DrawCounters
+{
+    std::size_t drawCalls;
+    std::size_t vertices;
+    std::size_t textureSwitches;
+    std::size_t shaderSwitches;
+    std::size_t stateChanges;
+    float milliseconds;
+};
+
+class RenderStatistics
+{
+public:
+    RenderStatistics();
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const;
+
+    void setLogFile(const std::string& fileName);
+
+    void beginFrame();
+    void endFrame();
+
+    void setCaller(std::string_view caller);
+    void clearCaller();
+
+    void recordDraw(const sf::RenderStates& states, std::size_t vertexCount);
+    void recordDraw(const sf::Sprite& sprite, sf::RenderStates states);
+    void recordDraw(const sf::Text& text, sf::RenderStates states);
+
+    template<typename T>
+    void draw(sf::RenderTarget& target, const T& drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+
+    const std::vector<std::pair<std::string_view, DrawCounters>>& getFrameCounters() const;
+    std::string getSummary() const;
+
+private:
+    bool enabled;
+    std::size_t frame;
+
+    std::vector<std::pair<std::string_view, DrawCounters>> currentCounters;
+    std::vector<std::pair<std::string_view, DrawCounters>> frameCounters;
+    std::optional<std::size_t> callerIndex;
+    std::chrono::high_resolution_clock::time_point callerStart;
+
+    const sf::Texture* lastTexture;
+    const sf::Shader* lastShader;
+    sf::BlendMode lastBlendMode;
+
+    std::ofstream logFile;
+
+    void closeCaller();
+
+    std::size_t getVertexCount(const sf::Text& text) const;
+};
+
+namespace Statistics
+{
+    extern RenderStatistics renderStatistics;
+}
+
+
+template<typename T>
+void RenderStatistics::draw(sf::RenderTarget& target, const T& drawable, const sf::RenderStates& states)
+{
+    target.draw(drawable, states);
+
+    this->recordDraw(drawable, states);
+}
\ No newline at end of file
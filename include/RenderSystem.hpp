@@ -8,25 +8,65 @@ InversePalindrome.com
 #pragma once
 
 #include "System.hpp"
+#include "RenderGrid.hpp"
+#include "SpriteBatch.hpp"
+#include "FrameSnapshot.hpp"
 
 #include <brigand/sequences/list.hpp>
+#include <brigand/sequences/size.hpp>
+#include <brigand/algorithms/index_of.hpp>
 
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/View.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
 
+#include <array>
+#include <vector>
+#include <algorithm>
+
 
 class RenderSystem : public System, public sf::Drawable
 {
-    using Renderables = brigand::list<SpriteComponent, TextComponent, DialogComponent, ParticleComponent>;
+    using Renderables = brigand::list<SpriteComponent, TextComponent, DialogComponent>;
+    using UnbatchedRenderables = brigand::list<TextComponent, DialogComponent>;
 
 public:
     RenderSystem(Entities& entities, Events& events);
 
     virtual void update(float deltaTime) override;
 
+    void capture(FrameSnapshot& snapshot, const sf::View& view) const;
+
+    template<typename T>
+    void queryEntities(const sf::View& view, std::vector<Entity>& entities) const;
+    template<typename T>
+    void queryEntities(const sf::FloatRect& area, std::vector<Entity>& entities) const;
+
 private:
+    std::array<RenderGrid, brigand::size<Renderables>::value> renderGrids;
+    mutable sf::Vector2f viewSize;
+    mutable std::vector<Entity> visibleEntities;
+    mutable SpriteBatch spriteBatch;
+
     virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
+    void batchSprites(const sf::View& view) const;
+
     void setParentTransforms(Entity childEntity, Entity parentEntity, const sf::Vector2f& offset);
-};
\ No newline at end of file
+};
+
+template<typename T>
+void RenderSystem::queryEntities(const sf::View& view, std::vector<Entity>& entities) const
+{
+    this->queryEntities<T>(sf::FloatRect(view.getCenter() - view.getSize() / 2.f, view.getSize()), entities);
+}
+
+template<typename T>
+void RenderSystem::queryEntities(const sf::FloatRect& area, std::vector<Entity>& entities) const
+{
+    this->renderGrids[brigand::index_of<Renderables, T>::value].query(area, entities);
+
+    entities.erase(std::remove_if(std::begin(entities), std::end(entities), [](auto entity) { return !entity.sync() || !entity.template has_component<T>(); }),
+        std::end(entities));
+}
\ No newline at end of file
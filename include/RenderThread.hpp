@@ -0,0 +1,59 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - RenderThread.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include "FrameSnapshot.hpp"
+
+#include <SFML/Graphics/RenderWindow.hpp>
+
+#include <array>
+#include <mutex>
+#include <thread>
+#include <cstddef>
+#include <functional>
+#include <condition_variable>
+
+
+class RenderThread
+{
+public:
+    explicit RenderThread(sf::RenderWindow& window);
+    RenderThread(const RenderThread& renderThread) = delete;
+    RenderThread& operator=(const RenderThread& renderThread) = delete;
+    ~RenderThread();
+
+    void start();
+    void stop();
+
+    bool isRunning() const;
+
+    FrameSnapshot& getSnapshot();
+
+    void submit(std::function<void(const FrameSnapshot&)> present);
+    void execute(std::function<void()> job);
+
+    void wait();
+
+private:
+    sf::RenderWindow& window;
+
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    std::array<FrameSnapshot, 2u> snapshots;
+    std::size_t writeIndex;
+
+    std::function<void()> pendingJob;
+    bool running;
+    bool busy;
+    bool stopping;
+
+    void post(std::function<void()> job);
+    void run();
+};
\ No newline at end of file
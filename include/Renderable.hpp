@@ -13,6 +13,9 @@ InversePalindrome.com
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/Transformable.hpp>
 
+#include <cstddef>
+#include <optional>
+
 
 class Renderable : public sf::Transformable, public sf::Drawable
 {
@@ -21,14 +24,17 @@ public:
 
     sf::Vector2f getOffset() const;
     bool isVisible() const;
+    std::optional<std::size_t> getGridEntry() const;
 
     void setOffset(const sf::Vector2f& offset);
 
     void setVisibilityStatus(bool visibilityStatus);
+    void setGridEntry(std::size_t gridEntry);
 
 private:
     sf::Vector2f offset;
     bool visibilityStatus;
+    std::optional<std::size_t> gridEntry;
 
     virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const = 0;
 };
\ No newline at end of file
@@ -0,0 +1,34 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - ResolutionScaler.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include <SFML/Graphics/View.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <memory>
+#include <functional>
+
+
+class ResolutionScaler : public sf::Drawable
+{
+public:
+    ResolutionScaler();
+
+    bool render(const sf::View& view, float renderScale, const std::function<void(sf::RenderTarget&)>& drawScene);
+
+private:
+    std::unique_ptr<sf::RenderTexture> renderTexture;
+    sf::Sprite sprite;
+    sf::Vector2u failedSize;
+
+    virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+};
\ No newline at end of file
@@ -7,6 +7,8 @@ InversePalindrome.com
 
 #pragma once
 
+#include "TextureAtlas.hpp"
+
 #include <Thor/Resources/ResourceHolder.hpp>
 #include <Thor/Resources/ResourceLoader.hpp>
 
@@ -15,6 +17,7 @@ InversePalindrome.com
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
 
+#include <optional>
 #include <functional>
 #include <unordered_map>
 
@@ -42,23 +45,34 @@ enum class SoundBuffersID : std::size_t
 class ResourceManager
 {
 public:
-    ResourceManager() = default;
-    ResourceManager(const std::string& resourcesFilePath);
+    ResourceManager(const std::string& resourcesFilePath, bool mediaEnabled = true);
     ResourceManager(const ResourceManager& resourceManager) = delete;
     ResourceManager& operator=(const ResourceManager& resourceManager) = delete;
 
     void loadResources(const std::string& resourcesFilePath);
 
     sf::Texture& getTexture(TexturesID textureID);
+    std::optional<TextureRegion> getTextureRegion(TexturesID textureID, const sf::IntRect& textureRect);
     sf::Image& getImage(ImagesID imageID);
     sf::Font& getFont(FontsID fontID);
     sf::SoundBuffer& getSound(SoundBuffersID soundBuffersID);
 
+    bool isMediaEnabled() const;
+
+    void setAtlasFence(std::function<void()> atlasFence);
+
 private:
     thor::ResourceHolder<sf::Texture, TexturesID> textures;
     thor::ResourceHolder<sf::Image, ImagesID> images;
     thor::ResourceHolder<sf::Font, FontsID> fonts;
     thor::ResourceHolder<sf::SoundBuffer, SoundBuffersID> sounds;
 
+    sf::Texture placeholderTexture;
+    sf::Image placeholderImage;
+    sf::Font placeholderFont;
+
+    TextureAtlas atlas;
+    bool mediaEnabled;
+
     std::unordered_map<std::string, std::function<void(std::size_t, const std::string&)>> resourceFactory;
 };
\ No newline at end of file
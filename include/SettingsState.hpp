@@ -14,6 +14,7 @@ InversePalindrome.com
 #include <SFGUI/Scale.hpp>
 #include <SFGUI/Button.hpp>
 #include <SFGUI/Scrollbar.hpp>
+#include <SFGUI/CheckButton.hpp>
 #include <SFGUI/Adjustment.hpp>
 #include <SFGUI/RadioButtonGroup.hpp>
 
@@ -32,6 +33,7 @@ public:
 
     virtual bool isTransparent() const override;
     virtual bool isDependent() const override;
+    virtual bool isIdle() const override;
 
 private:
     sf::Sprite background;
@@ -48,9 +50,24 @@ private:
     sfg::Scrollbar::Ptr soundScrollbar;
     sfg::Scrollbar::Ptr musicScrollbar;
     sfg::RadioButtonGroup::Ptr keyButtons;
+    sfg::CheckButton::Ptr adaptiveQualityButton;
+    sfg::Label::Ptr renderScaleLabel;
+    sfg::Label::Ptr particleDensityLabel;
+    sfg::Label::Ptr animationLODLabel;
+    sfg::Label::Ptr aiTickRateLabel;
+    sfg::Adjustment::Ptr renderScaleAdjustment;
+    sfg::Adjustment::Ptr particleDensityAdjustment;
+    sfg::Adjustment::Ptr animationLODAdjustment;
+    sfg::Adjustment::Ptr aiTickRateAdjustment;
+    sfg::Scrollbar::Ptr renderScaleScrollbar;
+    sfg::Scrollbar::Ptr particleDensityScrollbar;
+    sfg::Scrollbar::Ptr animationLODScrollbar;
+    sfg::Scrollbar::Ptr aiTickRateScrollbar;
 
     void adjustSoundVolume();
     void adjustMusicVolume();
+    void adjustQuality();
+    void toggleAdaptiveQuality();
     void changeKeyBinding(sf::Keyboard::Key key);
 
     void saveSettings();
@@ -0,0 +1,42 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - ShaderChunkTiles.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+
+#include <array>
+
+
+class ShaderChunkTiles : public sf::Drawable
+{
+public:
+    ShaderChunkTiles(const sf::Texture& texture, sf::Shader& shader, const sf::Vector2f& tileSize, const sf::Vector2u& tileCount, const sf::Color& color);
+
+    void setTile(const sf::Vector2u& position, const sf::Vector2u& tileIndex);
+    void upload();
+
+    static bool loadShader(sf::Shader& shader);
+    static bool canIndex(const sf::Vector2u& tilesetTileCount);
+
+private:
+    const sf::Texture& texture;
+    sf::Shader& shader;
+    sf::Vector2f tileSize;
+    sf::Image tileIndices;
+    sf::Texture indexTexture;
+    std::array<sf::Vertex, 4u> quad;
+
+    void draw(sf::RenderTarget& renderTarget, sf::RenderStates states) const override;
+};
\ No newline at end of file
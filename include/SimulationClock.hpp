@@ -0,0 +1,32 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - SimulationClock.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include <SFML/System/Time.hpp>
+
+
+class SimulationClock
+{
+public:
+    SimulationClock();
+
+    void advance(sf::Time timeStep);
+
+    sf::Time getElapsedTime() const;
+
+private:
+    sf::Time elapsedTime;
+};
+
+namespace Simulation
+{
+    extern SimulationClock clock;
+
+    const float timeStep = 1.f / 60.f;
+    const float maxFrameTime = 0.25f;
+}
\ No newline at end of file
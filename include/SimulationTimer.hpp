@@ -0,0 +1,35 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - SimulationTimer.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include <SFML/System/Time.hpp>
+
+
+class SimulationTimer
+{
+public:
+    SimulationTimer();
+
+    sf::Time getRemainingTime() const;
+
+    bool isRunning() const;
+    bool isExpired() const;
+
+    void start();
+    void stop();
+    void reset(sf::Time timeLimit);
+    void restart(sf::Time timeLimit);
+
+private:
+    sf::Time timeLimit;
+    sf::Time elapsedTime;
+    sf::Time startTime;
+    bool running;
+
+    sf::Time getElapsedTime() const;
+};
\ No newline at end of file
@@ -27,27 +27,28 @@ public:
     SoundManager(ResourceManager& resourceManager);
     SoundManager(const SoundManager& soundManager) = delete;
     SoundManager& operator=(const SoundManager& soundManager) = delete;
+    virtual ~SoundManager() = default;
 
     const AudioProperties& getSoundProperties() const;
     const AudioProperties& getMusicProperties() const;
 
-    void update();
+    virtual void update();
 
-    void playSound(SoundBuffersID soundBufferID, bool loop);
-    void stopSound(SoundBuffersID soundID);
-    void stopAllSounds();
+    virtual void playSound(SoundBuffersID soundBufferID, bool loop);
+    virtual void stopSound(SoundBuffersID soundID);
+    virtual void stopAllSounds();
 
-    void playMusic(const std::string& name, bool loop);
-    void stopMusic(const std::string& name);
-    void stopAllMusic();
+    virtual void playMusic(const std::string& name, bool loop);
+    virtual void stopMusic(const std::string& name);
+    virtual void stopAllMusic();
 
-    void setSoundPosition(SoundBuffersID soundID, const sf::Vector3f& position);
+    virtual void setSoundPosition(SoundBuffersID soundID, const sf::Vector3f& position);
 
-    void setListenerPosition(const sf::Vector3f& position);
-    void setListenerDirection(const sf::Vector3f& direction);
+    virtual void setListenerPosition(const sf::Vector3f& position);
+    virtual void setListenerDirection(const sf::Vector3f& direction);
 
-    void setSoundVolume(float volume);
-    void setMusicVolume(float volume);
+    virtual void setSoundVolume(float volume);
+    virtual void setMusicVolume(float volume);
 
 private:
     AudioProperties soundProperties;
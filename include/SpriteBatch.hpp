@@ -0,0 +1,42 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - SpriteBatch.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <utility>
+
+
+class SpriteBatch : public sf::Drawable
+{
+public:
+    SpriteBatch();
+
+    void clear();
+
+    void addSprite(const sf::Sprite& sprite, const sf::Transform& transform);
+    void addQuad(const sf::Texture& texture, const std::array<sf::Vertex, 4u>& quad);
+
+private:
+    std::vector<std::pair<const sf::Texture*, sf::VertexArray>> batches;
+    std::size_t batchCount;
+
+    sf::VertexArray& getVertices(const sf::Texture& texture);
+
+    virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+};
\ No newline at end of file
@@ -15,6 +15,9 @@ InversePalindrome.com
 #include <SFML/Graphics/Texture.hpp>
 
 #include <string>
+#include <vector>
+#include <utility>
+#include <optional>
 
 
 class SpriteComponent : public Component, public Renderable
@@ -29,17 +32,26 @@ public:
     sf::FloatRect getGlobalBounds() const;
 
     TexturesID getTextureID() const;
+    const sf::IntRect& getTextureRect() const;
     sf::Sprite& getSprite();
+    const sf::Sprite& getSprite() const;
 
     void setSprite(const std::string& fileName);
+    void setTextureRect(const sf::IntRect& textureRect);
+
+    void packTextureRect(const sf::IntRect& textureRect);
 
 private:
     TexturesID textureID;
+    sf::IntRect textureRect;
     sf::Sprite sprite;
     std::string fileName;
+    std::vector<std::pair<sf::IntRect, std::optional<TextureRegion>>> frameRegions;
 
     ResourceManager* resourceManager;
 
+    const std::optional<TextureRegion>& getTextureRegion(const sf::IntRect& textureRect);
+
     virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 };
 
@@ -8,9 +8,9 @@ InversePalindrome.com
 #pragma once
 
 #include "State.hpp"
+#include "ParticleEngine.hpp"
 
 #include <Thor/Particles/Emitters.hpp>
-#include <Thor/Particles/ParticleSystem.hpp>
 
 #include <SFML/Graphics/View.hpp>
 #include <SFML/Graphics/Text.hpp>
@@ -35,8 +35,9 @@ private:
     sf::Text titleLabel;
     sf::Text continueLabel;
 
-    thor::ParticleSystem particleSystem;
+    ParticleEngine particleEngine;
     thor::UniversalEmitter emitter;
+    std::size_t particlePool;
 
     void transitionToMenu();
 };
\ No newline at end of file
@@ -12,6 +12,7 @@ InversePalindrome.com
 
 struct StateData;
 class StateMachine;
+class FrameSnapshot;
 
 class State
 {
@@ -21,11 +22,13 @@ public:
     virtual void handleEvent(const sf::Event& event) = 0;
     virtual void update(float deltaTime) = 0;
     virtual void draw() = 0;
+    virtual bool capture(FrameSnapshot& snapshot);
 
     virtual void showWidgets(bool showStatus);
 
     virtual bool isTransparent() const;
     virtual bool isDependent() const;
+    virtual bool isIdle() const;
 
 protected:
     StateMachine& stateMachine;
@@ -12,8 +12,11 @@ InversePalindrome.com
 #include "GUIManager.hpp"
 #include "InputHandler.hpp"
 #include "SoundManager.hpp"
+#include "GraphicsProperties.hpp"
 #include "ResourceManager.hpp"
+#include "RenderThread.hpp"
 
+#include <SFML/Graphics/View.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 
 #include <vector>
@@ -22,14 +25,20 @@ InversePalindrome.com
 struct StateData
 {
     StateData(std::vector<Game>& games, ResourceManager& resourceManager, SoundManager& soundManager,
-        GUIManager& guiManager, InputHandler& inputHandler, sf::RenderWindow& window);
+        GUIManager* guiManager, InputHandler& inputHandler, GraphicsProperties& graphicsProperties,
+        sf::RenderWindow& window, RenderThread& renderThread);
 
     std::vector<Game>& games;
 
     ResourceManager& resourceManager;
     SoundManager& soundManager;
-    GUIManager& guiManager;
+    GUIManager* guiManager;
     InputHandler& inputHandler;
+    GraphicsProperties& graphicsProperties;
 
     sf::RenderWindow& window;
+    RenderThread& renderThread;
+
+    sf::View defaultView;
+    bool isHeadless;
 };
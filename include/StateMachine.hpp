@@ -10,6 +10,7 @@ InversePalindrome.com
 #include "State.hpp"
 #include "StateID.hpp"
 #include "StateData.hpp"
+#include "FrameSnapshot.hpp"
 
 #include <memory>
 #include <vector>
@@ -27,6 +28,9 @@ public:
     void handleEvent(const sf::Event& event);
     void update(float deltaTime);
     void draw();
+    bool capture(FrameSnapshot& snapshot);
+
+    bool isIdle() const;
 
     StatePtr& operator[](std::size_t statePosition);
     std::size_t size() const;
@@ -46,10 +50,14 @@ private:
     std::vector<std::pair<StateID, StatePtr>> states;
     std::vector<std::function<void()>> stateActions;
     std::unordered_map<StateID, std::function<StatePtr()>> stateFactory;
+    bool statesChanged;
 
     StatePtr getState(StateID stateID);
+    std::size_t getFirstUpdatedState() const;
+    std::size_t getFirstDrawnState() const;
 
     void processStateActions();
+    void hideWidgets();
 };
 
 
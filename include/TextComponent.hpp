@@ -10,6 +10,7 @@ InversePalindrome.com
 #include "Component.hpp"
 #include "Renderable.hpp"
 #include "ResourceManager.hpp"
+#include "FrameSnapshot.hpp"
 
 #include <SFML/Graphics/Text.hpp>
 
@@ -25,6 +26,8 @@ public:
 
     void setText(const std::string& text);
 
+    void capture(FrameSnapshot& snapshot, sf::RenderStates states = sf::RenderStates::Default) const;
+
 private:
     sf::Text text;
     std::string fileName;
@@ -0,0 +1,68 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - TextureAtlas.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <optional>
+#include <functional>
+#include <unordered_map>
+
+
+struct TextureRegion
+{
+    const sf::Texture* texture;
+    sf::IntRect textureRect;
+};
+
+class TextureAtlas
+{
+public:
+    TextureAtlas();
+
+    std::optional<TextureRegion> getRegion(const sf::Texture& texture, const sf::IntRect& textureRect);
+
+    std::size_t getPageCount() const;
+
+    void setPackingFence(std::function<void()> packingFence);
+    void setEnabled(bool enabled);
+
+private:
+    struct Page
+    {
+        std::unique_ptr<sf::RenderTexture> renderTexture;
+        sf::Vector2u shelfPosition;
+        unsigned shelfHeight;
+    };
+
+    struct PackedRegion
+    {
+        sf::IntRect sourceRect;
+        std::size_t page;
+        sf::Vector2i position;
+    };
+
+    unsigned pageSize;
+    std::vector<Page> pages;
+    std::unordered_map<const sf::Texture*, std::vector<PackedRegion>> packedRegions;
+    std::unordered_map<const sf::Texture*, std::vector<sf::IntRect>> rejectedRegions;
+    std::function<void()> packingFence;
+    bool enabled;
+
+    std::optional<TextureRegion> findRegion(const sf::Texture& texture, const sf::IntRect& textureRect) const;
+    bool isRejected(const sf::Texture& texture, const sf::IntRect& textureRect) const;
+    bool packRegion(const sf::Texture& texture, const sf::IntRect& sourceRect);
+
+    bool allocate(Page& page, const sf::Vector2u& size, sf::Vector2u& position);
+    bool addPage();
+};
\ No newline at end of file
@@ -0,0 +1,16 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - TileRenderMode.hpp
+InversePalindrome.com
+*/
+
+
+#pragma once
+
+#include <cstddef>
+
+
+enum class TileRenderMode : std::size_t
+{
+    Vertices, Shader
+};
\ No newline at end of file
@@ -9,8 +9,7 @@ InversePalindrome.com
 
 #include "Component.hpp"
 #include "Callbacks.hpp"
-
-#include <Thor/Time/Timer.hpp>
+#include "SimulationTimer.hpp"
 
 #include <unordered_map>
 
@@ -41,7 +40,7 @@ public:
 
 private:
     std::string fileName;
-    std::unordered_map<std::string, std::pair<thor::Timer, float>> timers;
+    std::unordered_map<std::string, std::pair<SimulationTimer, float>> timers;
     Callbacks callbacks;
 };
 
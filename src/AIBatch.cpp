@@ -0,0 +1,118 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - AIBatch.cpp
+InversePalindrome.com
+*/
+
+
+#include "AIBatch.hpp"
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NIHIL_AI_SSE
+#include <emmintrin.h>
+#endif
+
+
+void AIBatch::clear()
+{
+    this->AIXPositions.clear();
+    this->AIYPositions.clear();
+    this->targetXPositions.clear();
+    this->targetYPositions.clear();
+    this->visionRanges.clear();
+    this->attackRanges.clear();
+    this->patrolMinimums.clear();
+    this->patrolMaximums.clear();
+    this->facingDirections.clear();
+    this->facingHeights.clear();
+    this->alwaysFacing.clear();
+    this->masks.clear();
+}
+
+void AIBatch::addTarget(const AIProfile& profile, const sf::Vector2f& targetPosition)
+{
+    this->AIXPositions.push_back(profile.position.x);
+    this->AIYPositions.push_back(profile.position.y);
+    this->targetXPositions.push_back(targetPosition.x);
+    this->targetYPositions.push_back(targetPosition.y);
+    this->visionRanges.push_back(profile.visionRange < 0.f ? -1.f : profile.visionRange * profile.visionRange);
+    this->attackRanges.push_back(profile.attackRange < 0.f ? -1.f : profile.attackRange * profile.attackRange);
+    this->patrolMinimums.push_back(profile.patrolRange.first);
+    this->patrolMaximums.push_back(profile.patrolRange.second);
+    this->facingDirections.push_back(profile.direction == Direction::Right ? 1.f : profile.direction == Direction::Left ? -1.f : 0.f);
+    this->facingHeights.push_back(profile.facingHeight);
+    this->alwaysFacing.push_back(profile.direction == Direction::Up ? 1.f : 0.f);
+}
+
+void AIBatch::evaluate()
+{
+    this->masks.assign(this->size(), 0u);
+
+    std::size_t index = 0u;
+
+#ifdef NIHIL_AI_SSE
+    const auto zero = _mm_setzero_ps();
+    const auto signMask = _mm_set1_ps(-0.f);
+
+    for (; index + 4u <= this->size(); index += 4u)
+    {
+        const auto AIX = _mm_loadu_ps(&this->AIXPositions[index]);
+        const auto AIY = _mm_loadu_ps(&this->AIYPositions[index]);
+        const auto targetX = _mm_loadu_ps(&this->targetXPositions[index]);
+        const auto targetY = _mm_loadu_ps(&this->targetYPositions[index]);
+
+        const auto deltaX = _mm_sub_ps(targetX, AIX);
+        const auto deltaY = _mm_sub_ps(targetY, AIY);
+        const auto distance = _mm_add_ps(_mm_mul_ps(deltaX, deltaX), _mm_mul_ps(deltaY, deltaY));
+
+        const auto vision = _mm_movemask_ps(_mm_cmple_ps(distance, _mm_loadu_ps(&this->visionRanges[index])));
+        const auto attack = _mm_movemask_ps(_mm_cmple_ps(distance, _mm_loadu_ps(&this->attackRanges[index])));
+        const auto patrol = _mm_movemask_ps(_mm_and_ps(_mm_cmpge_ps(targetX, _mm_loadu_ps(&this->patrolMinimums[index])),
+            _mm_cmple_ps(targetX, _mm_loadu_ps(&this->patrolMaximums[index]))));
+
+        const auto isAhead = _mm_cmpgt_ps(_mm_mul_ps(deltaX, _mm_loadu_ps(&this->facingDirections[index])), zero);
+        const auto isLevel = _mm_cmple_ps(_mm_andnot_ps(signMask, deltaY), _mm_loadu_ps(&this->facingHeights[index]));
+        const auto facing = _mm_movemask_ps(_mm_or_ps(_mm_and_ps(isAhead, isLevel), _mm_cmpgt_ps(_mm_loadu_ps(&this->alwaysFacing[index]), zero)));
+
+        for (std::size_t lane = 0u; lane < 4u; ++lane)
+        {
+            this->masks[index + lane] = static_cast<std::uint8_t>(((vision >> lane) & 1) | (((attack >> lane) & 1) << 1) |
+                (((patrol >> lane) & 1) << 2) | (((facing >> lane) & 1) << 3));
+        }
+    }
+#endif
+
+    this->evaluateRange(index, this->size());
+}
+
+bool AIBatch::hasPredicate(std::size_t index, AIPredicate predicate) const
+{
+    return this->masks[index] & static_cast<std::uint8_t>(predicate);
+}
+
+std::size_t AIBatch::size() const
+{
+    return this->AIXPositions.size();
+}
+
+void AIBatch::evaluateRange(std::size_t begin, std::size_t end)
+{
+    for (auto index = begin; index < end; ++index)
+    {
+        const auto deltaX = this->targetXPositions[index] - this->AIXPositions[index];
+        const auto deltaY = this->targetYPositions[index] - this->AIYPositions[index];
+        const auto distance = deltaX * deltaX + deltaY * deltaY;
+
+        const auto isFacing = (deltaX * this->facingDirections[index] > 0.f && std::abs(deltaY) <= this->facingHeights[index]) ||
+            this->alwaysFacing[index] > 0.f;
+
+        this->masks[index] = static_cast<std::uint8_t>(
+            (distance <= this->visionRanges[index] ? static_cast<std::uint8_t>(AIPredicate::WithinVisionRange) : 0u) |
+            (distance <= this->attackRanges[index] ? static_cast<std::uint8_t>(AIPredicate::WithinAttackRange) : 0u) |
+            (this->targetXPositions[index] >= this->patrolMinimums[index] && this->targetXPositions[index] <= this->patrolMaximums[index] ?
+                static_cast<std::uint8_t>(AIPredicate::WithinPatrolRange) : 0u) |
+            (isFacing ? static_cast<std::uint8_t>(AIPredicate::FacingTarget) : 0u));
+    }
+}
\ No newline at end of file
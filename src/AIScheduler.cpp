@@ -0,0 +1,96 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - AIScheduler.cpp
+InversePalindrome.com
+*/
+
+
+#include "AIScheduler.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+
+AIScheduler::AIScheduler(float timeBudget, float nearDistance, float farDistance) :
+    currentFrame(0u),
+    timeBudget(timeBudget),
+    nearDistance(nearDistance),
+    farDistance(farDistance),
+    tickRateScale(1.f),
+    agentBudget(0u)
+{
+}
+
+void AIScheduler::beginFrame()
+{
+    ++this->currentFrame;
+
+    this->frameStart = std::chrono::high_resolution_clock::now();
+}
+
+std::optional<std::size_t> AIScheduler::getOverdueFrames(std::int32_t AIID, float distance)
+{
+    const auto updateInterval = this->getUpdateInterval(distance);
+
+    auto lastUpdate = this->lastUpdates.find(AIID);
+
+    if (lastUpdate == std::end(this->lastUpdates))
+    {
+        const auto phase = static_cast<std::size_t>(std::abs(AIID)) % updateInterval;
+
+        lastUpdate = this->lastUpdates.emplace(AIID, this->currentFrame - phase - 1u).first;
+    }
+
+    const auto elapsedFrames = this->currentFrame - lastUpdate->second;
+
+    if (elapsedFrames >= updateInterval)
+    {
+        return elapsedFrames - updateInterval;
+    }
+
+    return {};
+}
+
+void AIScheduler::markUpdated(std::int32_t AIID)
+{
+    this->lastUpdates[AIID] = this->currentFrame;
+}
+
+bool AIScheduler::hasBudgetLeft(std::size_t scheduledAgents) const
+{
+    if (this->agentBudget > 0u)
+    {
+        return scheduledAgents < this->agentBudget;
+    }
+
+    const std::chrono::duration<float> elapsedTime = std::chrono::high_resolution_clock::now() - this->frameStart;
+
+    return elapsedTime.count() < this->timeBudget;
+}
+
+void AIScheduler::setTickRateScale(float tickRateScale)
+{
+    this->tickRateScale = std::clamp(tickRateScale, 0.1f, 1.f);
+}
+
+void AIScheduler::setAgentBudget(std::size_t agentBudget)
+{
+    this->agentBudget = agentBudget;
+}
+
+std::size_t AIScheduler::getUpdateInterval(float distance) const
+{
+    auto updateInterval = 1.f;
+
+    if (distance > this->farDistance)
+    {
+        updateInterval = 12.f;
+    }
+    else if (distance > this->nearDistance)
+    {
+        updateInterval = 4.f;
+    }
+
+    return static_cast<std::size_t>(std::round(updateInterval / this->tickRateScale));
+}
\ No newline at end of file
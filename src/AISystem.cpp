@@ -7,15 +7,21 @@ InversePalindrome.com
 
 #include "AISystem.hpp"
 #include "MathUtility.hpp"
+#include "UnitConverter.hpp"
 #include "EntityUtility.hpp"
 #include "CollisionData.hpp"
 
+#include <cmath>
 #include <limits>
+#include <algorithm>
 
 
-AISystem::AISystem(Entities& entities, Events& events, Pathways& pathways) :
+AISystem::AISystem(Entities& entities, Events& events, b2World& world, Pathways& pathways, NavigationGraph& navigationGraph) :
     System(entities, events),
-    pathways(pathways)
+    pathways(pathways),
+    navigationGraph(navigationGraph),
+    scheduler(0.002f, 1024.f, 3072.f),
+    perception(world, 3u)
 {
     events.subscribe<entityplus::component_added<Entity, ControllableComponent>>([this](const auto & event)
         {
@@ -30,53 +36,196 @@ void AISystem::update(float deltaTime)
 {
     if (const auto & targetPosition = this->getTargetPosition())
     {
-        this->entities.for_each<AI, PatrolComponent, PositionComponent>([this, targetPosition](auto entity, auto & patrol, auto & position)
+        this->scheduler.beginFrame();
+        this->perception.beginFrame();
+        this->scheduledAIs.clear();
+
+        this->entities.for_each<AI, PositionComponent>([this, targetPosition](auto entity, auto & position)
             {
-                if (patrol.hasWaypoints())
+                if (const auto overdueFrames = this->scheduler.getOverdueFrames(position.getEntityID(), Utility::distance(position.getPosition(), targetPosition.value())))
                 {
-                    if (entity.has_component<ChaseComponent>() && this->isWithinRange(entity, position.getPosition(), targetPosition.value(), entity.get_component<ChaseComponent>().getVisionRange()))
-                    {
-                        this->chaseTarget(patrol, position.getPosition(), targetPosition.value());
-                    }
-
-                    this->updateMovement(entity, patrol, position.getPosition());
+                    this->scheduledAIs.push_back({ overdueFrames.value(), entity });
                 }
             });
 
-        this->entities.for_each<AI, RangeAttackComponent, PositionComponent, TimerComponent>([this, targetPosition](auto entity, auto & rangeAttack, auto & position, auto & timer)
+        std::stable_sort(std::begin(this->scheduledAIs), std::end(this->scheduledAIs),
+            [](const auto & AI1, const auto & AI2) { return AI1.first > AI2.first; });
+
+        this->batch.clear();
+        this->batchedAIs.clear();
+        this->batchedTargets.clear();
+
+        for (auto& [overdueFrames, entity] : this->scheduledAIs)
+        {
+            if (!this->scheduler.hasBudgetLeft(this->batchedAIs.size()))
             {
-                if (timer.hasTimer("Reload") && timer.hasTimerExpired("Reload") && this->isFacingTarget(entity) &&
-                    this->isWithinRange(entity, position.getPosition(), targetPosition.value(), rangeAttack.getAttackRange()))
-                {
-                    this->events.broadcast(ShootProjectile{ entity, rangeAttack.getProjectileID() });
+                break;
+            }
 
-                    timer.restartTimer("Reload");
-                }
+            this->addToBatch(entity);
+        }
+
+        this->batch.evaluate();
+
+        for (std::size_t i = 0u; i < this->batchedAIs.size(); ++i)
+        {
+            if (i > 0u && !this->scheduler.hasBudgetLeft(i))
+            {
+                break;
+            }
+
+            this->updateAI(this->batchedAIs[i]);
+
+            this->scheduler.markUpdated(this->batchedAIs[i].entity.get_component<PositionComponent>().getEntityID());
+        }
+    }
+    else
+    {
+        this->entities.for_each<AI, IntentComponent>([](auto entity, auto & intent)
+            {
+                intent.setMovementStatus(false);
             });
     }
 }
 
-void AISystem::updateMovement(Entity entity, PatrolComponent& patrol, const sf::Vector2f& position)
+void AISystem::setTickRateScale(float tickRateScale)
+{
+    this->scheduler.setTickRateScale(tickRateScale);
+}
+
+void AISystem::setAgentBudget(std::size_t agentBudget)
+{
+    this->scheduler.setAgentBudget(agentBudget);
+}
+
+void AISystem::addToBatch(Entity entity)
+{
+    const auto& position = entity.get_component<PositionComponent>();
+
+    AIProfile profile{ position.getPosition(), -1.f, -1.f,
+        { std::numeric_limits<float>::lowest(), std::numeric_limits<float>::max() }, Direction::Right, 0.f };
+
+    if (entity.has_component<ChaseComponent>())
+    {
+        profile.visionRange = entity.get_component<ChaseComponent>().getVisionRange();
+    }
+    if (entity.has_component<RangeAttackComponent>())
+    {
+        profile.attackRange = entity.get_component<RangeAttackComponent>().getAttackRange();
+    }
+    if (entity.has_component<PatrolComponent>() && entity.get_component<PatrolComponent>().hasPathway())
+    {
+        profile.patrolRange = this->pathways[entity.get_component<PatrolComponent>().getPathwayIndex()].getRange();
+    }
+    if (entity.has_component<PhysicsComponent>())
+    {
+        const auto& physics = entity.get_component<PhysicsComponent>();
+
+        profile.direction = physics.getDirection();
+        profile.facingHeight = UnitConverter::metersToPixels(physics.getBodySize().y);
+    }
+
+    const auto firstTarget = this->batchedTargets.size();
+    const auto perceptionRange = std::max(profile.visionRange, profile.attackRange);
+
+    if (perceptionRange > 0.f)
+    {
+        for (const auto& target : this->perception.perceive(position.getEntityID(), position.getPosition(), perceptionRange, ObjectType::Player))
+        {
+            this->batch.addTarget(profile, target.position);
+            this->batchedTargets.push_back(target);
+        }
+    }
+
+    this->batchedAIs.push_back({ entity, firstTarget, this->batchedTargets.size() });
+}
+
+void AISystem::updateAI(const BatchedAI& batchedAI)
 {
-    const auto& waypoint = patrol.getCurrentWaypoint();
+    auto entity = batchedAI.entity;
+
+    const PerceivedTarget* visibleTarget = nullptr;
+    const PerceivedTarget* attackableTarget = nullptr;
+
+    for (auto index = batchedAI.firstTarget; index < batchedAI.lastTarget; ++index)
+    {
+        if (this->batch.hasPredicate(index, AIPredicate::WithinPatrolRange))
+        {
+            if (this->batch.hasPredicate(index, AIPredicate::WithinVisionRange))
+            {
+                visibleTarget = &this->batchedTargets[index];
+            }
+            if (this->batch.hasPredicate(index, AIPredicate::WithinAttackRange) && this->batch.hasPredicate(index, AIPredicate::FacingTarget))
+            {
+                attackableTarget = &this->batchedTargets[index];
+            }
+
+            break;
+        }
+    }
 
-    if (position.x > waypoint.point.x)
+    if (entity.has_component<PatrolComponent>() && entity.has_component<IntentComponent>())
     {
-        this->events.broadcast(ChangeDirection{ entity, Direction::Left });
+        this->updatePatrol(entity, entity.get_component<PatrolComponent>(), entity.get_component<IntentComponent>(),
+            entity.get_component<PositionComponent>().getPosition(), visibleTarget);
+    }
+
+    if (entity.has_component<RangeAttackComponent>() && entity.has_component<TimerComponent>())
+    {
+        this->updateRangeAttack(entity, entity.get_component<RangeAttackComponent>(), entity.get_component<TimerComponent>(), attackableTarget);
+    }
+}
+
+void AISystem::updatePatrol(Entity entity, PatrolComponent& patrol, IntentComponent& intent, const sf::Vector2f& position, const PerceivedTarget* target)
+{
+    if (patrol.hasPathway() && this->pathways[patrol.getPathwayIndex()].hasWaypoints())
+    {
+        const auto& pathway = this->pathways[patrol.getPathwayIndex()];
+
+        const auto isChasing = target && this->chaseTarget(entity, intent, position, target->position);
+
+        if (!isChasing)
+        {
+            this->updateMovement(intent, position, pathway[patrol.getCurrentWaypointIndex()].point);
+        }
     }
     else
     {
-        this->events.broadcast(ChangeDirection{ entity, Direction::Right });
+        intent.setMovementStatus(false);
     }
+}
+
+void AISystem::updateRangeAttack(Entity entity, RangeAttackComponent& rangeAttack, TimerComponent& timer, const PerceivedTarget* target)
+{
+    if (target && timer.hasTimer("Reload") && timer.hasTimerExpired("Reload"))
+    {
+        this->events.broadcast(ShootProjectile{ entity, rangeAttack.getProjectileID() });
 
-    if (position.y > waypoint.point.y)
+        timer.restartTimer("Reload");
+    }
+}
+
+void AISystem::updateMovement(IntentComponent& intent, const sf::Vector2f& position, const sf::Vector2f& destination)
+{
+    if (position.x > destination.x)
     {
-        this->events.broadcast(Jumped{ entity });
+        intent.setDirection(Direction::Left);
     }
+    else
+    {
+        intent.setDirection(Direction::Right);
+    }
+
+    intent.setJumpStatus(position.y > destination.y);
 }
 
 void AISystem::addProperties(Entity entity)
 {
+    if (entity.has_tag<AI>() && !entity.has_component<IntentComponent>())
+    {
+        entity.add_component<IntentComponent>();
+    }
+
     if (entity.has_tag<Turret>() && entity.has_component<PhysicsComponent>())
     {
         auto& physics = entity.get_component<PhysicsComponent>();
@@ -92,69 +241,78 @@ void AISystem::addProperties(Entity entity)
 
     if (entity.has_component<PatrolComponent>())
     {
-        if (auto pathway = this->getPathway(entity))
+        if (auto pathwayIndex = this->getPathwayIndex(entity))
         {
-            pathway.value().sortWaypoints();
-
-            entity.get_component<PatrolComponent>().setPathway(pathway.value());
+            entity.get_component<PatrolComponent>().setPathwayIndex(pathwayIndex.value());
         }
     }
 }
 
 void AISystem::changeWaypoint(Entity entity)
 {
-    if (entity.has_component<PatrolComponent>())
+    if (entity.has_component<PatrolComponent>() && entity.get_component<PatrolComponent>().hasPathway())
     {
-        entity.get_component<PatrolComponent>().moveToNextWaypoint();
+        auto& patrol = entity.get_component<PatrolComponent>();
+
+        patrol.moveToNextWaypoint(this->pathways[patrol.getPathwayIndex()].size());
     }
 }
 
-void AISystem::chaseTarget(PatrolComponent& patrol, const sf::Vector2f& AIPosition, const sf::Vector2f& targetPosition)
+bool AISystem::chaseTarget(Entity entity, IntentComponent& intent, const sf::Vector2f& AIPosition, const sf::Vector2f& targetPosition)
 {
-    const auto& waypoints = patrol.getPathway().getWaypoints();
+    if (!entity.has_component<PhysicsComponent>())
+    {
+        return false;
+    }
 
-    std::size_t waypointIndex = 0u;
-    auto minDistance = std::numeric_limits<float>().max();
+    const auto& physics = entity.get_component<PhysicsComponent>();
 
-    for (std::size_t i = 0u; i < waypoints.size(); ++i)
+    if (physics.isMidAir())
     {
-        const auto& distance = Utility::distance(AIPosition, waypoints[i].point);
+        return true;
+    }
+
+    const auto* path = this->navigationGraph.findPath(AIPosition, targetPosition, physics.getJumpVelocity(), physics.getMaxVelocity().x);
 
-        if (targetPosition.x - AIPosition.x < 0.f)
+    if (!path)
+    {
+        return false;
+    }
+
+    if (path->empty())
+    {
+        this->updateMovement(intent, AIPosition, targetPosition);
+    }
+    else
+    {
+        const auto& link = path->front();
+
+        if (std::abs(AIPosition.x - link.departure.x) > UnitConverter::metersToPixels(physics.getBodySize().x))
         {
-            if (waypoints[i].point.x < AIPosition.x && distance < minDistance)
-            {
-                waypointIndex = i;
-                minDistance = distance;
-            }
+            this->updateMovement(intent, AIPosition, link.departure);
         }
         else
         {
-            if (waypoints[i].point.x > AIPosition.x && distance < minDistance)
+            this->updateMovement(intent, AIPosition, link.arrival);
+
+            if (link.type == NavigationLinkType::Jump)
             {
-                waypointIndex = i;
-                minDistance = distance;
+                intent.setJumpStatus(true);
             }
         }
     }
 
-    patrol.setCurrentWaypointIndex(waypointIndex);
+    return true;
 }
 
-std::optional<Pathway> AISystem::getPathway(Entity entity)
+std::optional<std::size_t> AISystem::getPathwayIndex(Entity entity)
 {
     if (entity.has_component<PhysicsComponent>())
     {
         auto entityPathwayID = static_cast<std::size_t>(static_cast<CollisionData*>(entity.get_component<PhysicsComponent>()
             .getUserData(ObjectType::Enemy))->properties["PathwayID"].getIntValue());
 
-        for (const auto& [pathwayID, pathway] : this->pathways)
-        {
-            if (pathwayID == entityPathwayID)
-            {
-                return pathway;
-            }
-        }
+        return this->pathways.getPathwayIndex(entityPathwayID);
     }
 
     return {};
@@ -168,39 +326,4 @@ std::optional<sf::Vector2f> AISystem::getTargetPosition()
     }
 
     return {};
-}
-
-bool AISystem::isWithinRange(Entity AI, const sf::Vector2f& AIPosition, const sf::Vector2f& targetPosition, float visionRange)
-{
-    bool isWithingPatrolRange = true;
-
-    if (AI.has_component<PatrolComponent>())
-    {
-        const auto& [initialPosition, finalPosition] = AI.get_component<PatrolComponent>().getRange();
-
-        if (targetPosition.x < initialPosition || targetPosition.x > finalPosition)
-        {
-            isWithingPatrolRange = false;
-        }
-    }
-
-    return Utility::distance(AIPosition, targetPosition) <= visionRange && isWithingPatrolRange;
-}
-
-bool AISystem::isFacingTarget(Entity entity)
-{
-    if (this->targetEntity.sync() && this->targetEntity.has_component<PhysicsComponent>() && entity.has_component<PhysicsComponent>())
-    {
-        const auto& entityPhysics = entity.get_component<PhysicsComponent>();
-
-        const auto& entityPosition = entityPhysics.getPosition();
-        const auto& targetPosition = this->targetEntity.get_component<PhysicsComponent>().getPosition();
-
-        return   (((entityPhysics.getDirection() == Direction::Right && targetPosition.x > entityPosition.x)
-            || (entityPhysics.getDirection() == Direction::Left && targetPosition.x < entityPosition.x)) &&
-            std::abs(entityPosition.y - targetPosition.y) <= entityPhysics.getBodySize().y)
-            || entityPhysics.getDirection() == Direction::Up;
-    }
-
-    return false;
 }
\ No newline at end of file
@@ -8,6 +8,7 @@ InversePalindrome.com
 #include "AchievementDisplay.hpp"
 #include "SpriteParser.hpp"
 #include "TextStyleParser.hpp"
+#include "RenderStatistics.hpp"
 
 
 AchievementDisplay::AchievementDisplay(ResourceManager& resourceManager) :
@@ -35,6 +36,17 @@ void AchievementDisplay::update()
     this->displayTimer.update();
 }
 
+void AchievementDisplay::capture(FrameSnapshot& snapshot) const
+{
+    if (this->isVisible())
+    {
+        const sf::RenderStates states(this->getTransform());
+
+        snapshot.add(this->background, states);
+        snapshot.add(this->text, states);
+    }
+}
+
 void AchievementDisplay::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
     if (this->isVisible())
@@ -43,5 +55,8 @@ void AchievementDisplay::draw(sf::RenderTarget& target, sf::RenderStates states)
 
         target.draw(this->background, states);
         target.draw(this->text, states);
+
+        Statistics::renderStatistics.recordDraw(this->background, states);
+        Statistics::renderStatistics.recordDraw(this->text, states);
     }
 }
\ No newline at end of file
@@ -11,6 +11,7 @@ InversePalindrome.com
 #include "SpriteParser.hpp"
 #include "GUIParser.hpp"
 #include "TextStyleParser.hpp"
+#include "RenderStatistics.hpp"
 
 #include <SFGUI/Scale.hpp>
 #include <SFGUI/Table.hpp>
@@ -56,10 +57,10 @@ AchievementsState::AchievementsState(StateMachine& stateMachine, StateData& stat
 
     scale->SetAdjustment(adjustment);
 
-    stateData.guiManager.addWidget(backButton);
-    stateData.guiManager.addWidget(scrolledWindow);
+    stateData.guiManager->addWidget(backButton);
+    stateData.guiManager->addWidget(scrolledWindow);
 
-    Parsers::parseGUIProperties(stateData.guiManager, "AchievementsGUI.txt");
+    Parsers::parseGUIProperties(*stateData.guiManager, "AchievementsGUI.txt");
 
     loadAchievements("Achievements.txt");
 }
@@ -76,9 +77,14 @@ void AchievementsState::update(float deltaTime)
 
 void AchievementsState::draw()
 {
-    this->stateData.window.draw(this->background);
-    this->stateData.window.draw(this->titleBar);
-    this->stateData.window.draw(this->title);
+    Statistics::renderStatistics.draw(this->stateData.window, this->background);
+    Statistics::renderStatistics.draw(this->stateData.window, this->titleBar);
+    Statistics::renderStatistics.draw(this->stateData.window, this->title);
+}
+
+bool AchievementsState::isIdle() const
+{
+    return true;
 }
 
 bool AchievementsState::isTransparent() const
@@ -15,7 +15,8 @@ InversePalindrome.com
 
 AnimationComponent::AnimationComponent(const std::string& animationsFile) :
     Component("Animation"),
-    animationsFile(animationsFile)
+    animationsFile(animationsFile),
+    updateTime(0.f)
 {
     setAnimations(animationsFile);
 }
@@ -30,6 +31,7 @@ std::ostream& operator<<(std::ostream& os, const AnimationComponent& component)
 void AnimationComponent::setAnimations(const std::string& animationsFile)
 {
     this->animations = Parsers::parseAnimations(animationsFile, this->animator);
+    this->frames = Parsers::parseAnimationFrames(animationsFile);
     this->animationsFile = animationsFile;
 }
 
@@ -64,4 +66,19 @@ bool AnimationComponent::isPlayingAnimation() const
 bool AnimationComponent::hasAnimation(const Animation& animation) const
 {
     return this->animations.count(animation);
+}
+
+const std::vector<sf::IntRect>& AnimationComponent::getFrames() const
+{
+    return this->frames;
+}
+
+float AnimationComponent::getUpdateTime() const
+{
+    return this->updateTime;
+}
+
+void AnimationComponent::setUpdateTime(float updateTime)
+{
+    this->updateTime = updateTime;
 }
\ No newline at end of file
@@ -54,4 +54,33 @@ Animations Parsers::parseAnimations(const std::string& fileName, Animator& anima
     }
 
     return animations;
+}
+
+std::vector<sf::IntRect> Parsers::parseAnimationFrames(const std::string& fileName)
+{
+    std::vector<sf::IntRect> frames;
+
+    std::ifstream inFile(Path::animations / fileName);
+    std::string line;
+
+    while (std::getline(inFile, line))
+    {
+        std::istringstream iStream(line);
+
+        std::string category;
+
+        iStream >> category;
+
+        if (category == "Frame")
+        {
+            float frameTime = 0.f;
+            int left = 0, top = 0, width = 0, length = 0;
+
+            iStream >> frameTime >> left >> top >> width >> length;
+
+            frames.push_back({ left, top, width, length });
+        }
+    }
+
+    return frames;
 }
\ No newline at end of file
@@ -9,15 +9,28 @@ InversePalindrome.com
 #include "SpriteComponent.hpp"
 #include "ViewUtility.hpp"
 #include "AnimationComponent.hpp"
+#include "MathUtility.hpp"
+#include "SimulationClock.hpp"
 
+#include <cstdlib>
+#include <limits>
 
-AnimatorSystem::AnimatorSystem(Entities& entities, Events& events) :
-    System(entities, events)
+
+AnimatorSystem::AnimatorSystem(Entities& entities, Events& events, const RenderSystem& renderSystem, const sf::FloatRect& activeRegion) :
+    System(entities, events),
+    renderSystem(renderSystem),
+    activeRegion(activeRegion),
+    lodDistance(std::numeric_limits<float>::max()),
+    frameCount(0u)
 {
     events.subscribe<entityplus::component_added<Entity, AnimationComponent>>([this](const auto & event)
         {
+            event.component.setUpdateTime(Simulation::clock.getElapsedTime().asSeconds());
+
             playStartingAnimation(event.entity, event.component);
+            packAnimationFrames(event.entity);
         });
+    events.subscribe<entityplus::component_added<Entity, SpriteComponent>>([this](const auto & event) { packAnimationFrames(event.entity); });
     events.subscribe<PlayAnimation>([this](const auto & event) { playAnimation(event.entity, event.animation, event.loop); });
     events.subscribe<StopAnimation>([this](const auto & event) { stopAnimation(event.entity); });
     events.subscribe<StateChanged>([this](const auto & event) { changeAnimationState(event.entity, event.state); });
@@ -26,23 +39,76 @@ AnimatorSystem::AnimatorSystem(Entities& entities, Events& events) :
 
 void AnimatorSystem::update(float deltaTime)
 {
-    this->entities.for_each<AnimationComponent>(
-        [deltaTime](auto entity, auto & animation)
+    if (this->activeRegion.width <= 0.f || this->activeRegion.height <= 0.f)
+    {
+        this->entities.for_each<AnimationComponent>([this](auto entity, auto & animation) { updateAnimation(animation); });
+
+        return;
+    }
+
+    ++this->frameCount;
+
+    const sf::Vector2f center(this->activeRegion.left + this->activeRegion.width / 2.f, this->activeRegion.top + this->activeRegion.height / 2.f);
+
+    this->renderSystem.queryEntities<SpriteComponent>(this->activeRegion, this->visibleEntities);
+
+    for (auto entity : this->visibleEntities)
+    {
+        if (entity.has_component<AnimationComponent>() && this->isAnimationDue(entity, center))
         {
-            animation.update(deltaTime);
-        });
+            this->updateAnimation(entity.get_component<AnimationComponent>());
+        }
+    }
 }
 
-void AnimatorSystem::animate(sf::RenderTarget& target)
+void AnimatorSystem::animate(const sf::View& view)
 {
-    this->entities.for_each<AnimationComponent, SpriteComponent>(
-        [&target](auto entity, auto & animation, auto & sprite)
+    this->renderSystem.queryEntities<SpriteComponent>(view, this->visibleEntities);
+
+    for (auto entity : this->visibleEntities)
+    {
+        if (!entity.has_component<AnimationComponent>())
         {
-            if (Utility::isInsideView(target.getView(), sprite.getPosition(), sprite.getGlobalBounds()) && animation.isPlayingAnimation())
-            {
-                animation.animate(sprite.getSprite());
-            }
-        });
+            continue;
+        }
+
+        auto& animation = entity.get_component<AnimationComponent>();
+        auto& sprite = entity.get_component<SpriteComponent>();
+
+        if (Utility::isInsideView(view, sprite.getPosition(), sprite.getGlobalBounds()) && animation.isPlayingAnimation())
+        {
+            animation.animate(sprite.getSprite());
+
+            sprite.setTextureRect(sprite.getSprite().getTextureRect());
+        }
+    }
+}
+
+void AnimatorSystem::setLODDistance(float lodDistance)
+{
+    this->lodDistance = lodDistance;
+}
+
+bool AnimatorSystem::isAnimationDue(Entity entity, const sf::Vector2f& center) const
+{
+    const std::size_t lodInterval = 4u;
+
+    if (Utility::distance(entity.get_component<SpriteComponent>().getPosition(), center) <= this->lodDistance)
+    {
+        return true;
+    }
+
+    const auto phase = entity.has_component<PositionComponent>() ? static_cast<std::size_t>(std::abs(entity.get_component<PositionComponent>().getEntityID())) : 0u;
+
+    return (this->frameCount + phase) % lodInterval == 0u;
+}
+
+void AnimatorSystem::updateAnimation(AnimationComponent& animation)
+{
+    const auto elapsedTime = Simulation::clock.getElapsedTime().asSeconds();
+
+    animation.update(elapsedTime - animation.getUpdateTime());
+    animation.setUpdateTime(elapsedTime);
 }
 
 void AnimatorSystem::playAnimation(Entity entity, const Animation& animation, bool loop)
@@ -50,6 +116,7 @@ void AnimatorSystem::playAnimation(Entity entity, const Animation& animation, bo
     if (entity.has_component<AnimationComponent>())
     {
         entity.get_component<AnimationComponent>().playAnimation(animation, loop);
+        entity.get_component<AnimationComponent>().setUpdateTime(Simulation::clock.getElapsedTime().asSeconds());
     }
 }
 
@@ -68,6 +135,7 @@ void AnimatorSystem::changeAnimationState(Entity entity, EntityState state)
         auto& animation = entity.get_component<AnimationComponent>();
 
         animation.playAnimation({ state, entity.get_component<PhysicsComponent>().getDirection() }, true);
+        animation.setUpdateTime(Simulation::clock.getElapsedTime().asSeconds());
     }
 }
 
@@ -78,6 +146,7 @@ void AnimatorSystem::changeAnimationDirection(Entity entity, Direction direction
         auto& animation = entity.get_component<AnimationComponent>();
 
         animation.playAnimation({ entity.get_component<StateComponent>().getState(), direction }, true);
+        animation.setUpdateTime(Simulation::clock.getElapsedTime().asSeconds());
     }
 }
 
@@ -94,4 +163,17 @@ void AnimatorSystem::playStartingAnimation(Entity entity, AnimationComponent& an
             break;
         }
     }
+}
+
+void AnimatorSystem::packAnimationFrames(Entity entity)
+{
+    if (entity.has_component<AnimationComponent>() && entity.has_component<SpriteComponent>())
+    {
+        auto& sprite = entity.get_component<SpriteComponent>();
+
+        for (const auto& frame : entity.get_component<AnimationComponent>().getFrames())
+        {
+            sprite.packTextureRect(frame);
+        }
+    }
 }
\ No newline at end of file
@@ -16,13 +16,14 @@ InversePalindrome.com
 #include "PauseState.hpp"
 #include "AchievementsState.hpp"
 #include "FilePaths.hpp"
+#include "GlyphCache.hpp"
+#include "RenderStatistics.hpp"
 
 #include <Thor/Resources/SfmlLoaders.hpp>
 
 #include <SFML/Window/Event.hpp>
 
 #include <chrono>
-#include <fstream>
 #include <sstream>
 
 
@@ -31,11 +32,43 @@ Application::Application() :
     resourceManager("ResourcePaths.txt"),
     soundManager(resourceManager),
     guiManager(window),
-    stateData(games, resourceManager, soundManager, guiManager, inputHandler, window),
-    stateMachine(stateData)
+    graphicsProperties("GraphicsData.txt"),
+    renderThread(window),
+    stateData(games, resourceManager, soundManager, &guiManager, inputHandler, graphicsProperties, window, renderThread),
+    stateMachine(stateData),
+    qualityGovernor(graphicsProperties),
+    pendingRedraws(0u),
+    statisticsText("", resourceManager.getFont(FontsID::Roboto), 24u),
+    statisticsFrame(0u)
 {
     stateData.window.resetGLStates();
 
+    switch (graphicsProperties.framePacing)
+    {
+    case FramePacing::VSync:
+        window.setVerticalSyncEnabled(true);
+        break;
+    case FramePacing::Capped:
+        framePacer.setFrameRateLimit(graphicsProperties.frameRateLimit);
+        break;
+    }
+
+    statisticsText.setPosition(10.f, 10.f);
+    statisticsText.setOutlineThickness(2.f);
+    statisticsText.setOutlineColor(sf::Color::Black);
+
+    Statistics::renderStatistics.setEnabled(graphicsProperties.showRenderStatistics);
+
+    if (graphicsProperties.showRenderStatistics)
+    {
+        Statistics::renderStatistics.setLogFile(Path::miscellaneous / "RenderStatistics.csv");
+    }
+
+    qualityGovernor.setLogFile(Path::miscellaneous / "QualityGovernor.log");
+
+    resourceManager.setAtlasFence([this]() { renderThread.wait(); });
+    Rendering::glyphCache.setLoadingFence([this]() { renderThread.wait(); });
+
     stateMachine.registerState<SplashState>(StateID::Splash);
     stateMachine.registerState<StartState>(StateID::Start);
     stateMachine.registerState<MenuState>(StateID::Menu);
@@ -48,7 +81,12 @@ Application::Application() :
 
     stateMachine.pushState(StateID::Splash);
 
-    loadGames("SavedGames.txt");
+    games = loadGames("SavedGames.txt");
+
+    if (graphicsProperties.threadedRendering)
+    {
+        renderThread.start();
+    }
 }
 
 void Application::run()
@@ -65,8 +103,21 @@ void Application::run()
 
         handleEvents();
         update(deltaTime.count());
-        render();
+
+        if (isIdleFrame())
+        {
+            this->framePacer.idle();
+        }
+        else
+        {
+            render();
+
+            this->framePacer.endFrame();
+            this->qualityGovernor.addFrameTime(this->framePacer.getWorkTime());
+        }
     }
+
+    this->renderThread.stop();
 }
 
 void Application::handleEvents()
@@ -77,9 +128,12 @@ void Application::handleEvents()
 
     while (this->window.pollEvent(event))
     {
+        this->pendingRedraws = 2u;
+
         switch (event.type)
         {
         case sf::Event::Closed:
+            this->renderThread.wait();
             this->window.close();
             break;
         }
@@ -102,30 +156,108 @@ void Application::update(float deltaTime)
 
 void Application::render()
 {
+    const auto statisticsText = this->updateStatisticsText();
+
+    if (this->renderThread.isRunning() && !this->guiManager.hasVisibleWidgets())
+    {
+        auto& snapshot = this->renderThread.getSnapshot();
+
+        snapshot.clear();
+
+        if (this->stateMachine.capture(snapshot))
+        {
+            this->renderThread.submit([this, statisticsText](const auto & frame)
+                {
+                    this->presentFrame([this, &frame]()
+                        {
+                            Statistics::renderStatistics.setCaller("StateMachine");
+                            this->window.draw(frame);
+                        }, statisticsText);
+                });
+
+            return;
+        }
+    }
+
+    this->renderThread.execute([this, &statisticsText]()
+        {
+            this->presentFrame([this]()
+                {
+                    Statistics::renderStatistics.setCaller("StateMachine");
+                    this->stateMachine.draw();
+
+                    Statistics::renderStatistics.clearCaller();
+                    this->guiManager.display();
+                }, statisticsText);
+        });
+}
+
+void Application::presentFrame(const std::function<void()>& drawFrame, const sf::Text& statisticsText)
+{
+    Statistics::renderStatistics.beginFrame();
+
     this->window.clear();
 
-    this->stateMachine.draw();
-    this->guiManager.display();
+    drawFrame();
+
+    Statistics::renderStatistics.endFrame();
+
+    this->renderStatistics(statisticsText);
 
     this->window.display();
 }
 
-void Application::loadGames(const std::string& fileName)
+sf::Text Application::updateStatisticsText()
 {
-    std::ifstream inFile(Path::games / fileName);
-    std::string gameData;
-    std::string line;
+    const std::size_t refreshFrames = 30u;
 
-    while (std::getline(inFile, line))
+    if (Statistics::renderStatistics.isEnabled() && this->statisticsFrame++ % refreshFrames == 0u)
     {
-        if (line.empty())
+        std::string statisticsSummary;
+
         {
-            this->games.push_back(Game(gameData));
-            gameData.clear();
+            std::lock_guard<std::mutex> lock(this->statisticsMutex);
 
-            continue;
+            statisticsSummary = this->statisticsSummary;
         }
 
-        gameData += line + '\n';
+        this->statisticsText.setString(statisticsSummary + '\n' + this->framePacer.getSummary());
+
+        Rendering::glyphCache.prepare(this->statisticsText);
+        this->statisticsText.getLocalBounds();
     }
+
+    return this->statisticsText;
+}
+
+void Application::renderStatistics(const sf::Text& statisticsText)
+{
+    if (!Statistics::renderStatistics.isEnabled())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->statisticsMutex);
+
+        this->statisticsSummary = Statistics::renderStatistics.getSummary();
+    }
+
+    const auto view = this->window.getView();
+
+    this->window.setView(this->window.getDefaultView());
+    this->window.draw(statisticsText);
+    this->window.setView(view);
+}
+
+bool Application::isIdleFrame()
+{
+    if (this->pendingRedraws > 0u)
+    {
+        --this->pendingRedraws;
+
+        return false;
+    }
+
+    return this->graphicsProperties.idleRedraw && this->stateMachine.isIdle();
 }
\ No newline at end of file
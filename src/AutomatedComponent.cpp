@@ -10,12 +10,11 @@ InversePalindrome.com
 #include "UnitConverter.hpp"
 
 #include <fstream>
-#include <algorithm>
 
 
 AutomatedComponent::AutomatedComponent() :
     Component("Automated"),
-    taskIndex(0u)
+    elapsedTime(0.f)
 {
 }
 
@@ -26,33 +25,32 @@ std::ostream& operator<<(std::ostream& os, const AutomatedComponent& component)
     return os;
 }
 
-void AutomatedComponent::loadTasks(const std::string& fileName)
+void AutomatedComponent::loadPath(const std::string& fileName, const b2Vec2& origin, const b2Vec2& halfExtent, const b2Vec2& maxVelocity)
 {
     std::ifstream inFile(Path::miscellaneous / fileName);
 
+    std::vector<KinematicPath::Task> tasks;
+
     std::size_t direction = 0u;
     float xDestination = 0.f, yDestination = 0.f;
 
     while (inFile >> direction >> xDestination >> yDestination)
     {
-        this->tasks.push_back({ Direction{direction}, { UnitConverter::pixelsToMeters(xDestination), UnitConverter::pixelsToMeters(-yDestination) } });
+        tasks.push_back({ Direction{direction}, { UnitConverter::pixelsToMeters(xDestination), UnitConverter::pixelsToMeters(-yDestination) } });
     }
-}
 
-void AutomatedComponent::pushNextTask()
-{
-    if (++this->taskIndex == this->tasks.size())
-    {
-        this->taskIndex = 0u;
-    }
+    this->path.compile(tasks, origin, halfExtent, maxVelocity);
+    this->elapsedTime = 0.f;
 }
 
-AutomatedComponent::Task AutomatedComponent::getCurrentTask() const
+b2Vec2 AutomatedComponent::advance(float timeStep)
 {
-    return this->tasks[this->taskIndex];
+    this->elapsedTime += timeStep;
+
+    return this->path.getPosition(this->elapsedTime);
 }
 
-bool AutomatedComponent::hasTasks() const
+bool AutomatedComponent::hasPath() const
 {
-    return !this->tasks.empty();
+    return !this->path.isEmpty();
 }
\ No newline at end of file
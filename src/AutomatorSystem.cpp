@@ -12,54 +12,35 @@ InversePalindrome.com
 AutomatorSystem::AutomatorSystem(Entities& entities, Events& events) :
     System(entities, events)
 {
-    events.subscribe<AddedUserData>([this](auto & event) { addTasks(event.entity); });
-
-    for (std::size_t i = 0u; i < static_cast<std::size_t>(Direction::Size); ++i)
-    {
-        auto direction = Direction{ i };
-
-        registeredTasks[direction] = [&events, direction](auto entity) { events.broadcast(SetVelocity{ entity, direction }); };
-    }
+    events.subscribe<AddedUserData>([this](auto & event) { addPath(event.entity); });
 }
 
 void AutomatorSystem::update(float deltaTime)
 {
-    this->entities.for_each<AutomatedComponent>([this, deltaTime](auto entity, auto & automated)
+    if (deltaTime <= 0.f)
+    {
+        return;
+    }
+
+    this->entities.for_each<AutomatedComponent, PhysicsComponent>([deltaTime](auto entity, auto & automated, auto & physics)
         {
-            if (automated.hasTasks())
+            if (automated.hasPath())
             {
-                if (this->hasCompletedTask(entity, automated.getCurrentTask().second))
-                {
-                    automated.pushNextTask();
-                }
+                const auto target = automated.advance(deltaTime);
+                const auto position = physics.getPosition();
 
-                this->sendTask(entity, automated);
+                physics.setVelocity({ (target.x - position.x) / deltaTime, (target.y - position.y) / deltaTime });
             }
         });
 }
 
-void AutomatorSystem::addTasks(Entity entity)
+void AutomatorSystem::addPath(Entity entity)
 {
     if (entity.has_component<AutomatedComponent>() && entity.has_component<PhysicsComponent>())
     {
-        auto& automated = entity.get_component<AutomatedComponent>();
-        auto taskFile = static_cast<CollisionData*>(entity.get_component<PhysicsComponent>().getUserData(ObjectType::Platform))->properties["TaskFile"].getStringValue();
-
-        entity.get_component<AutomatedComponent>().loadTasks(taskFile);
-    }
-}
-
-void AutomatorSystem::sendTask(Entity entity, AutomatedComponent& automated)
-{
-    this->registeredTasks[automated.getCurrentTask().first](entity);
-}
+        const auto& physics = entity.get_component<PhysicsComponent>();
+        auto taskFile = static_cast<CollisionData*>(physics.getUserData(ObjectType::Platform))->properties["TaskFile"].getStringValue();
 
-bool AutomatorSystem::hasCompletedTask(Entity entity, const b2Vec2& target) const
-{
-    if (entity.has_component<PhysicsComponent>() && entity.get_component<PhysicsComponent>().isIntersecting(target))
-    {
-        return true;
+        entity.get_component<AutomatedComponent>().loadPath(taskFile, physics.getPosition(), physics.getBodySize(), physics.getMaxVelocity());
     }
-
-    return false;
 }
\ No newline at end of file
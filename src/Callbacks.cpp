@@ -17,10 +17,13 @@ void Callbacks::update()
 
     for (auto callbackTimer = std::begin(this->callbackTimers); callbackTimer != std::end(this->callbackTimers); )
     {
-        callbackTimer->update();
-
-        if (callbackTimer->isExpired())
+        if (callbackTimer->timer.isExpired())
         {
+            if (callbackTimer->callback)
+            {
+                callbackTimer->callback();
+            }
+
             callbackTimer = this->callbackTimers.erase(callbackTimer);
         }
         else
@@ -37,9 +40,8 @@ void Callbacks::addCallback(std::function<void()> callback)
 
 void Callbacks::addCallbackTimer(std::function<void()> callback, float callbackTime)
 {
-    this->callbackTimers.push_back(thor::CallbackTimer());
-    this->callbackTimers.back().connect0(callback);
-    this->callbackTimers.back().restart(sf::seconds(callbackTime));
+    this->callbackTimers.push_back({ SimulationTimer(), callback });
+    this->callbackTimers.back().timer.restart(sf::seconds(callbackTime));
 }
 
 void Callbacks::clearCallbacks()
@@ -54,8 +56,8 @@ void Callbacks::clearCallbackTimers()
 
 void Callbacks::disconnectCallbackTimers()
 {
-    for (auto& callback : this->callbackTimers)
+    for (auto& callbackTimer : this->callbackTimers)
     {
-        callback.clearConnections();
+        callbackTimer.callback = nullptr;
     }
 }
\ No newline at end of file
@@ -9,7 +9,7 @@ InversePalindrome.com
 
 
 Chunk::Chunk(const tmx::TileLayer& layer, std::vector<const tmx::Tileset*> tilesets,
-    const sf::Vector2f& position, const sf::Vector2f& tileCount, std::size_t rowSize, Textures& textures)
+    const sf::Vector2f& position, const sf::Vector2f& tileCount, std::size_t rowSize, Textures& textures, sf::Shader* tileShader)
 {
     auto opacity = static_cast<sf::Uint8>(layer.getOpacity() / 1.f * 255.f);
     sf::Color vertexColor = sf::Color::White;
@@ -21,10 +21,15 @@ Chunk::Chunk(const tmx::TileLayer& layer, std::vector<const tmx::Tileset*> tiles
 
     for (const auto ts : tilesets)
     {
-        bool chunkArrayCreated = false;
+        const auto& texture = *textures.find(ts->getImagePath())->second;
         auto tileSize = tmx::Vector2f(static_cast<float>(ts->getTileSize().x), static_cast<float>(ts->getTileSize().y));
 
-        sf::Vector2u tsTileCount;
+        sf::Vector2u tsTileCount(texture.getSize().x / static_cast<std::size_t>(tileSize.x), texture.getSize().y / static_cast<std::size_t>(tileSize.y));
+
+        std::unique_ptr<ChunkTiles> chunkTiles;
+        std::unique_ptr<ShaderChunkTiles> shaderChunkTiles;
+
+        const auto useShader = tileShader && ShaderChunkTiles::canIndex(tsTileCount);
 
         std::size_t xPos = static_cast<std::size_t>(position.x / tileSize.x);
         std::size_t yPos = static_cast<std::size_t>(position.y / tileSize.y);
@@ -35,23 +40,32 @@ Chunk::Chunk(const tmx::TileLayer& layer, std::vector<const tmx::Tileset*> tiles
             {
                 auto idx = (y * rowSize + x);
 
-                if (idx < tileIDs.size() && tileIDs[idx].ID >= ts->getFirstGID()
+                if (x < rowSize && idx < tileIDs.size() && tileIDs[idx].ID >= ts->getFirstGID()
                     && tileIDs[idx].ID < (ts->getFirstGID() + ts->getTileCount()))
                 {
-                    if (!chunkArrayCreated)
+                    auto idIndex = tileIDs[idx].ID - ts->getFirstGID();
+
+                    if (useShader)
                     {
-                        this->chunkTilesContainer.emplace_back(std::make_unique<ChunkTiles>(*textures.find(ts->getImagePath())->second));
-                        auto texSize = chunkTilesContainer.back()->getTextureSize();
-                        tsTileCount.x = texSize.x / static_cast<std::size_t>(tileSize.x);
-                        tsTileCount.y = texSize.y / static_cast<std::size_t>(tileSize.y);
-                        chunkArrayCreated = true;
+                        if (!shaderChunkTiles)
+                        {
+                            shaderChunkTiles = std::make_unique<ShaderChunkTiles>(texture, *tileShader, sf::Vector2f(tileSize.x, tileSize.y),
+                                sf::Vector2u(static_cast<unsigned>(tileCount.x), static_cast<unsigned>(tileCount.y)), vertexColor);
+                        }
+
+                        shaderChunkTiles->setTile({ static_cast<unsigned>(x - xPos), static_cast<unsigned>(y - yPos) },
+                            { idIndex % tsTileCount.x, idIndex / tsTileCount.x });
+
+                        continue;
                     }
 
-                    auto& ChunkContainer = chunkTilesContainer.back();
+                    if (!chunkTiles)
+                    {
+                        chunkTiles = std::make_unique<ChunkTiles>(texture);
+                    }
 
-                    sf::Vector2f tileOffset(x * tileSize.x, y * tileSize.y);
+                    sf::Vector2f tileOffset((x - xPos) * tileSize.x, (y - yPos) * tileSize.y);
 
-                    auto idIndex = tileIDs[idx].ID - ts->getFirstGID();
                     sf::Vector2f tileIndex(static_cast<float>(idIndex % tsTileCount.x), static_cast<float>(idIndex / tsTileCount.x));
                     tileIndex.x *= tileSize.x;
                     tileIndex.y *= tileSize.y;
@@ -63,10 +77,24 @@ Chunk::Chunk(const tmx::TileLayer& layer, std::vector<const tmx::Tileset*> tiles
                         sf::Vertex(tileOffset + sf::Vector2f(tileSize.x, tileSize.y), vertexColor, tileIndex + sf::Vector2f(tileSize.x, tileSize.y)),
                         sf::Vertex(tileOffset + sf::Vector2f(0.f, tileSize.y), vertexColor, tileIndex + sf::Vector2f(0.f, tileSize.y))
                     };
-                    ChunkContainer->addTile(tile);
+                    chunkTiles->addTile(tile);
                 }
             }
         }
+
+        if (chunkTiles)
+        {
+            chunkTiles->upload();
+
+            this->chunkTilesContainer.push_back(std::move(chunkTiles));
+        }
+
+        if (shaderChunkTiles)
+        {
+            shaderChunkTiles->upload();
+
+            this->chunkTilesContainer.push_back(std::move(shaderChunkTiles));
+        }
     }
 
     setPosition(position);
@@ -6,18 +6,38 @@ InversePalindrome.com
 
 
 #include "ChunkTiles.hpp"
+#include "RenderStatistics.hpp"
 
 
 ChunkTiles::ChunkTiles(const sf::Texture& texture) :
-    texture(texture)
+    texture(texture),
+    vertexBuffer(sf::Triangles, sf::VertexBuffer::Static)
 {
 }
 
 void ChunkTiles::addTile(const Tile& tile)
 {
-    for (const auto& vertex : tile)
+    for (auto index : { 0u, 1u, 2u, 0u, 2u, 3u })
     {
-        this->vertices.push_back(vertex);
+        this->vertices.push_back(tile[index]);
+    }
+}
+
+void ChunkTiles::upload()
+{
+    if (!sf::VertexBuffer::isAvailable() || this->vertices.empty())
+    {
+        return;
+    }
+
+    if (this->vertexBuffer.create(this->vertices.size()) && this->vertexBuffer.update(this->vertices.data()))
+    {
+        this->vertices.clear();
+        this->vertices.shrink_to_fit();
+    }
+    else
+    {
+        this->vertexBuffer.create(0u);
     }
 }
 
@@ -30,5 +50,16 @@ void ChunkTiles::draw(sf::RenderTarget& renderTarget, sf::RenderStates states) c
 {
     states.texture = &this->texture;
 
-    renderTarget.draw(this->vertices.data(), this->vertices.size(), sf::Quads, states);
+    if (this->vertexBuffer.getVertexCount())
+    {
+        renderTarget.draw(this->vertexBuffer, states);
+
+        Statistics::renderStatistics.recordDraw(states, this->vertexBuffer.getVertexCount());
+    }
+    else
+    {
+        renderTarget.draw(this->vertices.data(), this->vertices.size(), sf::Triangles, states);
+
+        Statistics::renderStatistics.recordDraw(states, this->vertices.size());
+    }
 }
\ No newline at end of file
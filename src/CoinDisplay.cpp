@@ -8,14 +8,21 @@ InversePalindrome.com
 #include "CoinDisplay.hpp"
 #include "AnimationParser.hpp"
 #include "TextStyleParser.hpp"
+#include "RenderStatistics.hpp"
 
 #include <Thor/Animations/FrameAnimation.hpp>
 
 
 CoinDisplay::CoinDisplay(ResourceManager& resourceManager) :
     coin(resourceManager.getTexture(TexturesID::Coin)),
-    text(std::to_string(0), resourceManager.getFont(FontsID::BITWONDER), 75u)
+    text(std::to_string(0))
 {
+    if (resourceManager.isMediaEnabled())
+    {
+        text.setFont(resourceManager.getFont(FontsID::BITWONDER));
+    }
+
+    text.setCharacterSize(75u);
     coin.setScale(1.5f, 1.5f);
 
     Parsers::parseStyle(resourceManager, "CoinStyle.txt", text);
@@ -42,6 +49,22 @@ void CoinDisplay::setNumberOfCoins(std::size_t coins)
     this->text.setString(std::to_string(coins));
 }
 
+void CoinDisplay::captureStatic(FrameSnapshot& snapshot) const
+{
+    if (this->isVisible())
+    {
+        snapshot.add(this->text, sf::RenderStates(this->getTransform()));
+    }
+}
+
+void CoinDisplay::batchAnimations(SpriteBatch& spriteBatch) const
+{
+    if (this->isVisible())
+    {
+        spriteBatch.addSprite(this->coin, this->getTransform());
+    }
+}
+
 void CoinDisplay::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
     if (this->isVisible())
@@ -50,5 +73,8 @@ void CoinDisplay::draw(sf::RenderTarget& target, sf::RenderStates states) const
 
         target.draw(this->coin, states);
         target.draw(this->text, states);
+
+        Statistics::renderStatistics.recordDraw(this->coin, states);
+        Statistics::renderStatistics.recordDraw(this->text, states);
     }
 }
\ No newline at end of file
@@ -52,12 +52,12 @@ bool CollisionFilter::ShouldCollide(b2Fixture* fixtureA, b2Fixture* fixtureB)
         }
     }
 
-    if (this->collisionTypes.count({ objectA->objectType, objectB->objectType }))
-    {
-        return false;
-    }
+    return this->shouldCollide(objectA->objectType, objectB->objectType);
+}
 
-    return true;
+bool CollisionFilter::shouldCollide(ObjectType objectA, ObjectType objectB) const
+{
+    return !this->collisionTypes.count({ objectA, objectB });
 }
 
 void CollisionFilter::manageCollisionIDs(Entity entityA, Entity entityB, bool collisionStatus)
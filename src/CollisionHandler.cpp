@@ -77,19 +77,6 @@ void CollisionHandler::BeginContact(b2Contact* contact)
 
         this->events.broadcast(CrossedWaypoint{ alive.entity });
     }
-    else if (const auto & orderedCollision = this->getOrderedCollision(objectA, objectB, ObjectType::Bullet, ObjectType::Alive))
-    {
-        const auto& [projectile, alive] = *orderedCollision;
-
-        this->events.broadcast(CombatOcurred{ projectile.entity, alive.entity });
-        this->events.broadcast(StopMovement{ alive.entity });
-    }
-    else if (const auto & orderedCollision = this->getOrderedCollision(objectA, objectB, ObjectType::Explosion, ObjectType::Alive))
-    {
-        const auto& [explosion, alive] = *orderedCollision;
-
-        this->events.broadcast(ApplyBlastImpact{ explosion.entity, alive.entity });
-    }
     else if (const auto & orderedCollision = this->getOrderedCollision(objectA, objectB, ObjectType::Player, ObjectType::Character))
     {
         const auto& character = orderedCollision->second;
@@ -135,11 +122,7 @@ void CollisionHandler::BeginContact(b2Contact* contact)
     {
         Utility::setFriction(&collider.value(), contact, 0.f);
     }
-    if (auto collider = this->getCollider(objectA, objectB, ObjectType::Bullet))
-    {
-        this->events.broadcast(DestroyEntity{ collider->entity });
-    }
-    else if (auto collider = this->getCollider(objectA, objectB, ObjectType::Bomb))
+    if (auto collider = this->getCollider(objectA, objectB, ObjectType::Bomb))
     {
         this->events.broadcast(ActivateBomb{ collider->entity });
     }
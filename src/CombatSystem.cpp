@@ -9,11 +9,20 @@ InversePalindrome.com
 #include "MathUtility.hpp"
 #include "UnitConverter.hpp"
 #include "FilePaths.hpp"
+#include "CollisionData.hpp"
 
+#include <Box2D/Dynamics/b2Body.h>
+#include <Box2D/Dynamics/b2Fixture.h>
 
-CombatSystem::CombatSystem(Entities& entities, Events& events, ComponentParser& componentParser) :
+#include <algorithm>
+
+
+CombatSystem::CombatSystem(Entities& entities, Events& events, b2World& world, ComponentParser& componentParser, ProjectileSystem& projectileSystem) :
     System(entities, events),
-    componentParser(componentParser)
+    world(world),
+    componentParser(componentParser),
+    projectileSystem(projectileSystem),
+    blastRadius(0.f)
 {
     events.subscribe<entityplus::component_added<Entity, HealthComponent>>([&events](const auto & event)
         {
@@ -29,11 +38,10 @@ CombatSystem::CombatSystem(Entities& entities, Events& events, ComponentParser&
         });
 
     events.subscribe<entityplus::component_added<Entity, RangeAttackComponent>>([this](const auto & event) { addReloadTimer(event.entity); });
-    events.subscribe<CombatOcurred>([this](const auto & event) { handleCombat(event.attacker, event.victim); });
+    events.subscribe<CombatOcurred>([this](const auto & event) { handleCombat(event.attacker, event.victim, event.damagePoints); });
     events.subscribe<ShootProjectile>([this](const auto & event) { shootProjectile(event.shooter, event.projectileID); });
     events.subscribe<ActivateBomb>([this](const auto & event) { addExplosion(event.bomb); });
     events.subscribe<ApplyKnockback>([this](const auto & event) { applyKnockback(event.attacker, event.victim); });
-    events.subscribe<ApplyBlastImpact>([this](const auto & event) { applyBlastImpact(event.explosion, event.victim); });
 }
 
 void CombatSystem::update(float deltaTime)
@@ -42,21 +50,20 @@ void CombatSystem::update(float deltaTime)
     this->callbacks.clearCallbacks();
 }
 
-void CombatSystem::handleCombat(Entity attacker, Entity victim)
+void CombatSystem::handleCombat(Entity attacker, Entity victim, std::optional<std::int32_t> damagePoints)
 {
-    std::int32_t damagePoints = 0;
-
-    if (attacker.has_component<MeleeAttackComponent>())
-    {
-        damagePoints = attacker.get_component<MeleeAttackComponent>().getDamagePoints();
-    }
-    else if (attacker.has_component<BulletComponent>())
+    if (!damagePoints)
     {
-        damagePoints = attacker.get_component<BulletComponent>().getDamagePoints();
-    }
-    else if (attacker.has_component<BombComponent>())
-    {
-        damagePoints = attacker.get_component<BombComponent>().getDamagePoints();
+        damagePoints = 0;
+
+        if (attacker.has_component<MeleeAttackComponent>())
+        {
+            damagePoints = attacker.get_component<MeleeAttackComponent>().getDamagePoints();
+        }
+        else if (attacker.has_component<BombComponent>())
+        {
+            damagePoints = attacker.get_component<BombComponent>().getDamagePoints();
+        }
     }
 
     if (victim.has_component<HealthComponent>())
@@ -65,7 +72,7 @@ void CombatSystem::handleCombat(Entity attacker, Entity victim)
 
         if (health.getHitpoints() > 0)
         {
-            health.setHitpoints(health.getHitpoints() - damagePoints);
+            health.setHitpoints(health.getHitpoints() - damagePoints.value());
         }
         if (victim.has_component<ControllableComponent>())
         {
@@ -98,6 +105,18 @@ void CombatSystem::shootProjectile(Entity shooter, const std::string & projectil
 {
     if (this->canShoot(shooter))
     {
+        if (shooter.has_component<PhysicsComponent>() && shooter.has_component<PositionComponent>() &&
+            this->projectileSystem.shootBullet(shooter, projectileID, shooter.get_component<PositionComponent>().getPosition() + this->getProjectileOffset(shooter),
+                shooter.get_component<PhysicsComponent>().getDirection()))
+        {
+            if (shooter.has_tag<Turret>())
+            {
+                this->events.broadcast(PlayAnimation{ shooter, { EntityState::Attacking, Direction::Right }, false });
+            }
+
+            return;
+        }
+
         auto projectileEntity = this->componentParser.parseEntity(-1, projectileID + ".txt");
 
         this->events.broadcast(ManageCollision{ shooter, projectileEntity, false });
@@ -111,41 +130,13 @@ void CombatSystem::shootProjectile(Entity shooter, const std::string & projectil
                 this->events.broadcast(PlayAnimation{ shooter, { EntityState::Attacking, Direction::Right }, false });
             }
         }
-        if (shooter.has_component<PhysicsComponent>() && projectileEntity.has_component<PhysicsComponent>() && projectileEntity.has_component<SpriteComponent>())
+        if (shooter.has_component<PhysicsComponent>() && projectileEntity.has_component<PhysicsComponent>() && projectileEntity.has_component<BombComponent>())
         {
-            const auto& shooterPhysics = shooter.get_component<PhysicsComponent>();
-            auto& projectilePhysics = projectileEntity.get_component<PhysicsComponent>();
-            auto& projectileSprite = projectileEntity.get_component<SpriteComponent>();
-
-            if (projectileEntity.has_component<BulletComponent>())
-            {
-                this->shootBullet(shooterPhysics, projectileEntity.get_component<BulletComponent>(), projectilePhysics, projectileSprite);
-            }
-            else if (projectileEntity.has_component<BombComponent>())
-            {
-                this->shootBomb(shooterPhysics, projectilePhysics);
-            }
+            this->shootBomb(shooter.get_component<PhysicsComponent>(), projectileEntity.get_component<PhysicsComponent>());
         }
     }
 }
 
-void CombatSystem::shootBullet(const PhysicsComponent & shooterPhysics, BulletComponent & bulletComponent, PhysicsComponent & projectilePhysics, SpriteComponent & projectileSprite)
-{
-    switch (shooterPhysics.getDirection())
-    {
-    case Direction::Left:
-        projectilePhysics.applyForce({ -bulletComponent.getForce(), 0.f });
-        projectileSprite.setRotation(180.f);
-        break;
-    case Direction::Right:
-        projectilePhysics.applyForce({ bulletComponent.getForce(), 0.f });
-        projectileSprite.setRotation(0.f);
-        break;
-    }
-
-    this->events.broadcast(PlaySound{ bulletComponent.getSoundID(), false });
-}
-
 void CombatSystem::shootBomb(const PhysicsComponent & shooterPhysics, PhysicsComponent & projectilePhysics)
 {
     if (this->targetEntity.sync() && this->targetEntity.has_component<PhysicsComponent>())
@@ -195,11 +186,13 @@ void CombatSystem::addExplosion(Entity bomb)
                 {
                     auto& bombComponent = bomb.get_component<BombComponent>();
 
-                    auto explosion = this->componentParser.parseEntity(-1, bombComponent.getExplosionID() + ".txt");
+                    auto explosion = this->componentParser.parseEntity(-1, bombComponent.getExplosionID() + ".txt", { "Physics" });
 
                     this->events.broadcast(CreateTransform{ explosion, bomb, {0.f, 0.f} });
                     this->events.broadcast(PlaySound{ bombComponent.getSoundID(), false });
 
+                    this->applyBlastImpact(bomb, this->getBlastRadius(bombComponent.getExplosionID()));
+
                     this->handleExplosion(bomb, explosion);
                 }
             }, bomb.get_component<BombComponent>().getExplosionTime());
@@ -237,25 +230,31 @@ void CombatSystem::applyKnockback(Entity attacker, Entity victim)
 
             victimPhysics.applyImpulse({ Utility::sign(blastDistance.x) * knockback, 0.f });
 
-            this->handleCombat(attacker, victim);
+            this->handleCombat(attacker, victim, {});
         }
     }
 }
 
-void CombatSystem::applyBlastImpact(Entity explosion, Entity victim)
+void CombatSystem::applyBlastImpact(Entity bomb, float radius)
 {
-    if (explosion.has_component<ChildComponent>())
+    if (bomb.has_component<PhysicsComponent>() && radius > 0.f)
     {
-        auto childID = explosion.get_component<ChildComponent>().getEntityID();
+        this->blastCenter = bomb.get_component<PhysicsComponent>().getPosition();
+        this->blastRadius = radius;
 
-        this->entities.for_each<BombComponent, ParentComponent>([this, victim, childID](auto entity, const auto & bomb, const auto & parent, entityplus::control_block_t & control)
-            {
-                if (parent.getChildID() == childID)
-                {
-                    this->applyKnockback(entity, victim);
-                    control.breakout = true;
-                }
-            });
+        this->blastBodies.clear();
+        this->blastVictims.clear();
+
+        b2AABB AABB;
+        AABB.lowerBound = this->blastCenter - b2Vec2(this->blastRadius, this->blastRadius);
+        AABB.upperBound = this->blastCenter + b2Vec2(this->blastRadius, this->blastRadius);
+
+        this->world.QueryAABB(this, AABB);
+
+        for (auto& victim : this->blastVictims)
+        {
+            this->applyKnockback(bomb, victim);
+        }
     }
 }
 
@@ -289,6 +288,27 @@ sf::Vector2f CombatSystem::getProjectileOffset(Entity entity)
     return {};
 }
 
+float CombatSystem::getBlastRadius(const std::string& explosionID)
+{
+    if (auto blastRadius = this->blastRadii.find(explosionID); blastRadius != std::end(this->blastRadii))
+    {
+        return blastRadius->second;
+    }
+
+    const auto& fields = this->componentParser.parseFields(explosionID + ".txt");
+
+    float blastRadius = 0.f;
+
+    if (auto physics = fields.find("Physics"); physics != std::cend(fields))
+    {
+        const auto& [bodySizeX, bodySizeY] = this->componentParser.parse<float, float>(physics->second);
+
+        blastRadius = std::max(bodySizeX, bodySizeY);
+    }
+
+    return this->blastRadii.emplace(explosionID, blastRadius).first->second;
+}
+
 bool CombatSystem::canShoot(Entity shooter)
 {
     if (this->targetEntity.sync() && shooter.has_component<PhysicsComponent>() && this->targetEntity.has_component<PhysicsComponent>() && shooter.has_tag<Turret>())
@@ -299,5 +319,30 @@ bool CombatSystem::canShoot(Entity shooter)
         return std::abs(shooterPhysics.getPosition().x - targetPhysics.getPosition().x) >= shooterPhysics.getBodySize().x;
     }
 
+    return true;
+}
+
+bool CombatSystem::ReportFixture(b2Fixture* fixture)
+{
+    auto* object = static_cast<CollisionData*>(fixture->GetUserData());
+    const auto* body = fixture->GetBody();
+
+    if (fixture->IsSensor() || !object || !object->isEntity || !(object->objectType & ObjectType::Alive) ||
+        std::find(std::cbegin(this->blastBodies), std::cend(this->blastBodies), body) != std::cend(this->blastBodies))
+    {
+        return true;
+    }
+
+    b2AABB AABB;
+    fixture->GetShape()->ComputeAABB(&AABB, body->GetTransform(), 0);
+
+    const b2Vec2 closestPoint(b2Clamp(this->blastCenter.x, AABB.lowerBound.x, AABB.upperBound.x), b2Clamp(this->blastCenter.y, AABB.lowerBound.y, AABB.upperBound.y));
+
+    if ((closestPoint - this->blastCenter).LengthSquared() <= this->blastRadius * this->blastRadius)
+    {
+        this->blastBodies.push_back(body);
+        this->blastVictims.push_back(object->entity);
+    }
+
     return true;
 }
\ No newline at end of file
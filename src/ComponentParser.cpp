@@ -22,6 +22,7 @@ InversePalindrome.com
 
 ComponentParser::ComponentParser(Entities& entities, ResourceManager& resourceManager, b2World& world) :
     entities(entities),
+    resourceManager(resourceManager),
     world(world),
     currentEntityID(0)
 {
@@ -85,28 +86,19 @@ ComponentParser::ComponentParser(Entities& entities, ResourceManager& resourceMa
         entity.add_component(std::make_from_tuple<ChaseComponent>(parse<float>(line)));
     };
 
-    componentParsers["SpriteA"] = [this, &resourceManager](auto & entity, const auto & line)
+    componentParsers["SpriteA"] = [this](auto & entity, const auto & line)
     {
-        const auto& [textureID, scaleX, scaleY] = parse<std::size_t, float, float>(line);
-
-        entity.add_component<SpriteComponent>(resourceManager, TexturesID{ textureID },
-            sf::Vector2f(scaleX, scaleY));
+        entity.add_component(this->parseSprite("SpriteA", line));
     };
 
-    componentParsers["SpriteB"] = [this, &resourceManager](auto & entity, const auto & line)
+    componentParsers["SpriteB"] = [this](auto & entity, const auto & line)
     {
-        const auto& [textureID, left, top, width, height, scaleX, scaleY]
-            = parse<std::size_t, std::size_t, std::size_t, std::size_t, std::size_t, float, float>(line);
-
-        entity.add_component<SpriteComponent>(resourceManager, TexturesID{ textureID },
-            sf::IntRect(left, top, width, height), sf::Vector2f(scaleX, scaleY));
+        entity.add_component(this->parseSprite("SpriteB", line));
     };
 
-    componentParsers["SpriteC"] = [this, &resourceManager](auto & entity, const auto & line)
+    componentParsers["SpriteC"] = [this](auto & entity, const auto & line)
     {
-        const auto& [fileName] = parse<std::string>(line);
-
-        entity.add_component<SpriteComponent>(resourceManager, fileName);
+        entity.add_component(this->parseSprite("SpriteC", line));
     };
 
     componentParsers["Text"] = [this, &resourceManager](auto & entity, const auto & line)
@@ -146,13 +138,6 @@ ComponentParser::ComponentParser(Entities& entities, ResourceManager& resourceMa
         entity.add_component(std::make_from_tuple<RangeAttackComponent>(parse<std::string, float, float>(line)));
     };
 
-    componentParsers["Bullet"] = [this](auto & entity, const auto & line)
-    {
-        const auto& [damagePoints, soundID, force] = this->parse<std::int32_t, std::size_t, float>(line);
-
-        entity.add_component<BulletComponent>(damagePoints, SoundBuffersID{ soundID }, force);
-    };
-
     componentParsers["Bomb"] = [this](auto & entity, const auto & line)
     {
         const auto& [damagePoints, soundID, explosionTime, explosionKnockback, explosionID]
@@ -166,11 +151,11 @@ ComponentParser::ComponentParser(Entities& entities, ResourceManager& resourceMa
         entity.add_component(std::make_from_tuple<AnimationComponent>(parse<std::string>(line)));
     };
 
-    componentParsers["Particle"] = [this, &resourceManager](auto & entity, const auto & line)
+    componentParsers["Particle"] = [this](auto & entity, const auto & line)
     {
         const auto& [effectRangeX, effectRangeY, particleFile, emitterFile] = parse<float, float, std::string, std::string>(line);
 
-        entity.add_component<ParticleComponent>(resourceManager, sf::Vector2f(effectRangeX, effectRangeY), particleFile, emitterFile);
+        entity.add_component<ParticleComponent>(sf::Vector2f(effectRangeX, effectRangeY), particleFile, emitterFile);
     };
 
     componentParsers["ParentA"] = [this](auto & entity, const auto & line)
@@ -198,6 +183,11 @@ ComponentParser::ComponentParser(Entities& entities, ResourceManager& resourceMa
         entity.add_component<AutomatedComponent>();
     };
 
+    componentParsers["Intent"] = [this](auto & entity, const auto & line)
+    {
+        entity.add_component<IntentComponent>();
+    };
+
     componentParsers["Pickup"] = [this](auto & entity, const auto & line)
     {
         const auto& [itemID, soundID] = this->parse<std::size_t, std::size_t>(line);
@@ -235,7 +225,12 @@ ComponentParser::ComponentParser(Entities& entities, ResourceManager& resourceMa
 
 Entity ComponentParser::parseEntity(std::int32_t entityType, const std::string& fileName)
 {
-    return this->parseComponents(++this->currentEntityID * entityType, fileName);
+    return this->parseEntity(entityType, fileName, {});
+}
+
+Entity ComponentParser::parseEntity(std::int32_t entityType, const std::string& fileName, const std::unordered_set<std::string>& excludedComponents)
+{
+    return this->parseComponents(++this->currentEntityID * entityType, fileName, excludedComponents);
 }
 
 void ComponentParser::parseBlueprint(const std::string& fileName)
@@ -253,7 +248,7 @@ void ComponentParser::parseBlueprint(const std::string& fileName)
 
         iStream >> entityID >> entityFile >> xPosition >> yPosition;
 
-        auto entity = this->parseComponents(entityID, entityFile);
+        auto entity = this->parseComponents(entityID, entityFile, {});
 
         Utility::setPosition(entity, sf::Vector2f(xPosition, yPosition));
     }
@@ -313,12 +308,42 @@ void ComponentParser::copyBlueprint(const std::string & fileName, const std::str
     }
 }
 
+std::unordered_map<std::string, std::string> ComponentParser::parseFields(const std::string& fileName) const
+{
+    std::unordered_map<std::string, std::string> fields;
+
+    std::ifstream inFile(Path::blueprints / fileName);
+    std::string line;
+
+    while (std::getline(inFile, line))
+    {
+        const auto componentName = this->parseComponentName(line);
+
+        fields.emplace(componentName, line);
+    }
+
+    return fields;
+}
+
+std::optional<sf::Sprite> ComponentParser::parseSprite(const std::unordered_map<std::string, std::string>& fields)
+{
+    for (const auto& componentName : { "SpriteA", "SpriteB", "SpriteC" })
+    {
+        if (auto sprite = fields.find(componentName); sprite != std::cend(fields))
+        {
+            return this->parseSprite(sprite->first, sprite->second).getSprite();
+        }
+    }
+
+    return {};
+}
+
 Entity ComponentParser::createEntity()
 {
     return this->entities.create_entity();
 }
 
-Entity ComponentParser::parseComponents(std::int32_t entityID, const std::string & fileName)
+Entity ComponentParser::parseComponents(std::int32_t entityID, const std::string & fileName, const std::unordered_set<std::string>& excludedComponents)
 {
     auto entity = this->createEntity();
 
@@ -327,17 +352,9 @@ Entity ComponentParser::parseComponents(std::int32_t entityID, const std::string
 
     while (std::getline(inFile, line))
     {
-        std::istringstream iStream(line);
-
-        std::string componentName;
-
-        iStream >> componentName;
-
-        line.erase(std::begin(line), std::begin(line) + componentName.size());
+        const auto componentName = this->parseComponentName(line);
 
-        boost::remove_erase_if(line, boost::is_any_of(",()"));
-
-        if (this->componentParsers.count(componentName))
+        if (this->componentParsers.count(componentName) && !excludedComponents.count(componentName))
         {
             this->componentParsers[componentName](entity, line);
         }
@@ -364,4 +381,40 @@ void ComponentParser::setComponentsID(Entity entity, std::int32_t entityID)
                 entity.get_component<Type>().setEntityID(entityID);
             }
         });
+}
+
+std::string ComponentParser::parseComponentName(std::string& line) const
+{
+    std::istringstream iStream(line);
+
+    std::string componentName;
+
+    iStream >> componentName;
+
+    line.erase(std::begin(line), std::begin(line) + componentName.size());
+
+    boost::remove_erase_if(line, boost::is_any_of(",()"));
+
+    return componentName;
+}
+
+SpriteComponent ComponentParser::parseSprite(const std::string& componentName, const std::string& line)
+{
+    if (componentName == "SpriteA")
+    {
+        const auto& [textureID, scaleX, scaleY] = parse<std::size_t, float, float>(line);
+
+        return SpriteComponent(this->resourceManager, TexturesID{ textureID }, sf::Vector2f(scaleX, scaleY));
+    }
+    else if (componentName == "SpriteB")
+    {
+        const auto& [textureID, left, top, width, height, scaleX, scaleY]
+            = parse<std::size_t, std::size_t, std::size_t, std::size_t, std::size_t, float, float>(line);
+
+        return SpriteComponent(this->resourceManager, TexturesID{ textureID }, sf::IntRect(left, top, width, height), sf::Vector2f(scaleX, scaleY));
+    }
+
+    const auto& [fileName] = parse<std::string>(line);
+
+    return SpriteComponent(this->resourceManager, fileName);
 }
\ No newline at end of file
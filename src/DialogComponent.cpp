@@ -7,6 +7,7 @@ InversePalindrome.com
 
 #include "DialogComponent.hpp"
 #include "FilePaths.hpp"
+#include "RenderStatistics.hpp"
 
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/algorithm/string/split.hpp>
@@ -101,6 +102,17 @@ bool DialogComponent::hasDialogueFinished() const
     return this->dialogueCount == this->subDialogues.size();
 }
 
+void DialogComponent::capture(FrameSnapshot& snapshot, sf::RenderStates states) const
+{
+    if (this->visibilityStatus)
+    {
+        states.transform *= this->getTransform();
+
+        snapshot.add(this->sprite.getSprite(), sf::RenderStates(states.transform * this->sprite.getTransform()));
+        this->text.capture(snapshot, states);
+    }
+}
+
 void DialogComponent::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
     if (this->visibilityStatus)
@@ -109,5 +121,8 @@ void DialogComponent::draw(sf::RenderTarget& target, sf::RenderStates states) co
 
         target.draw(sprite, states);
         target.draw(text, states);
+
+        Statistics::renderStatistics.recordDraw(sprite, states);
+        Statistics::renderStatistics.recordDraw(text, states);
     }
 }
\ No newline at end of file
@@ -10,19 +10,23 @@ InversePalindrome.com
 #include "AnimationParser.hpp"
 
 #include <Thor/Math/Distributions.hpp>
-#include <Thor/Particles/Affectors.hpp>
-#include <Thor/Animations/FadeAnimation.hpp>
-#include <Thor/Animations/ColorAnimation.hpp>
 
+#include <vector>
 #include <fstream>
 #include <sstream>
+#include <optional>
 #include <iostream>
 
-void Parsers::parseParticleSystem(ResourceManager& resourceManager, const std::string& fileName, thor::ParticleSystem& particleSystem)
+ParticleProperties Parsers::parseParticleProperties(ResourceManager& resourceManager, const std::string& fileName)
 {
+    ParticleProperties particleProperties{ nullptr, {}, {} };
+
     std::ifstream inFile(Path::particles / fileName);
     std::string line;
 
+    std::optional<TexturesID> particleTextureID;
+    std::vector<sf::IntRect> textureRects;
+
     while (std::getline(inFile, line))
     {
         std::istringstream iStream(line);
@@ -37,7 +41,7 @@ void Parsers::parseParticleSystem(ResourceManager& resourceManager, const std::s
 
             iStream >> textureID;
 
-            particleSystem.setTexture(resourceManager.getTexture(TexturesID{ textureID }));
+            particleTextureID = TexturesID{ textureID };
         }
         else if (category == "SubRect")
         {
@@ -45,7 +49,7 @@ void Parsers::parseParticleSystem(ResourceManager& resourceManager, const std::s
 
             iStream >> left >> top >> width >> height;
 
-            particleSystem.addTextureRect({ left, top, width, height });
+            textureRects.push_back({ left, top, width, height });
         }
         else if (category == "ForceAffector")
         {
@@ -53,7 +57,7 @@ void Parsers::parseParticleSystem(ResourceManager& resourceManager, const std::s
 
             iStream >> xForce >> yForce;
 
-            particleSystem.addAffector(thor::ForceAffector({ xForce, yForce }));
+            particleProperties.affectors.push_back({ AffectorType::Force, { xForce, yForce }, {} });
         }
         else if (category == "ScaleAffector")
         {
@@ -61,7 +65,7 @@ void Parsers::parseParticleSystem(ResourceManager& resourceManager, const std::s
 
             iStream >> xScale >> yScale;
 
-            particleSystem.addAffector(thor::ScaleAffector({ xScale, yScale }));
+            particleProperties.affectors.push_back({ AffectorType::Scale, { xScale, yScale }, {} });
         }
         else if (category == "TorqueAffector")
         {
@@ -69,7 +73,7 @@ void Parsers::parseParticleSystem(ResourceManager& resourceManager, const std::s
 
             iStream >> angularAcceleration;
 
-            particleSystem.addAffector(thor::TorqueAffector(angularAcceleration));
+            particleProperties.affectors.push_back({ AffectorType::Torque, { angularAcceleration, 0.f }, {} });
         }
         else if (category == "FadeAffector")
         {
@@ -77,7 +81,7 @@ void Parsers::parseParticleSystem(ResourceManager& resourceManager, const std::s
 
             iStream >> startingFade >> finalFade;
 
-            particleSystem.addAffector(thor::AnimationAffector(thor::FadeAnimation(startingFade, finalFade)));
+            particleProperties.affectors.push_back({ AffectorType::Fade, { startingFade, finalFade }, {} });
         }
         else if (category == "ColorAffector")
         {
@@ -85,9 +89,47 @@ void Parsers::parseParticleSystem(ResourceManager& resourceManager, const std::s
 
             iStream >> colorFile;
 
-            particleSystem.addAffector(thor::AnimationAffector(thor::ColorAnimation(Parsers::parseColors(colorFile))));
+            particleProperties.affectors.push_back({ AffectorType::Color, {}, Parsers::parseColors(colorFile) });
         }
     }
+
+    particleProperties.textureRects = textureRects;
+
+    if (!particleTextureID)
+    {
+        return particleProperties;
+    }
+
+    auto& texture = resourceManager.getTexture(particleTextureID.value());
+
+    const auto sourceRects = textureRects.empty() ?
+        std::vector<sf::IntRect>{ { 0, 0, static_cast<int>(texture.getSize().x), static_cast<int>(texture.getSize().y) } } : textureRects;
+
+    const sf::Texture* atlasTexture = nullptr;
+    std::vector<sf::IntRect> atlasRects;
+
+    for (const auto& sourceRect : sourceRects)
+    {
+        const auto region = resourceManager.getTextureRegion(particleTextureID.value(), sourceRect);
+
+        if (!region || (atlasTexture && region->texture != atlasTexture))
+        {
+            atlasTexture = nullptr;
+            break;
+        }
+
+        atlasTexture = region->texture;
+        atlasRects.push_back(region->textureRect);
+    }
+
+    particleProperties.texture = atlasTexture ? atlasTexture : &texture;
+
+    if (atlasTexture)
+    {
+        particleProperties.textureRects = atlasRects;
+    }
+
+    return particleProperties;
 }
 
 thor::UniversalEmitter Parsers::parseEmitter(const std::string& fileName)
@@ -8,17 +8,48 @@ InversePalindrome.com
 #include "EffectsSystem.hpp"
 
 
-EffectsSystem::EffectsSystem(Entities& entities, Events& events) :
-    System(entities, events)
+EffectsSystem::EffectsSystem(Entities& entities, Events& events, ResourceManager& resourceManager, const sf::FloatRect& activeRegion) :
+    System(entities, events),
+    activeRegion(activeRegion),
+    particleEngine(resourceManager)
 {
 }
 
 void EffectsSystem::update(float deltaTime)
 {
-    entities.for_each<ParticleComponent>(
-        [this, deltaTime](auto entity, auto & particle)
+    const auto hasActiveRegion = this->activeRegion.width > 0.f && this->activeRegion.height > 0.f;
+
+    this->entities.for_each<ParticleComponent>(
+        [this, deltaTime, hasActiveRegion](auto entity, auto & particle)
         {
-            particle.update(deltaTime);
+            if (entity.has_component<PositionComponent>())
+            {
+                particle.setPosition(entity.get_component<PositionComponent>().getPosition());
+            }
+
+            particle.update(this->particleEngine, !hasActiveRegion || particle.getGlobalBounds().intersects(this->activeRegion), deltaTime);
         });
+
+    this->particleEngine.releaseStaleAnchors();
+    this->particleEngine.update(deltaTime);
+}
+
+void EffectsSystem::clearParticles()
+{
+    this->particleEngine.clear();
+}
+
+void EffectsSystem::setEmissionScale(float emissionScale)
+{
+    this->particleEngine.setEmissionScale(emissionScale);
 }
 
+void EffectsSystem::capture(FrameSnapshot& snapshot) const
+{
+    this->particleEngine.capture(snapshot);
+}
+
+void EffectsSystem::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    target.draw(this->particleEngine, states);
+}
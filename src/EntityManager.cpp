@@ -12,6 +12,7 @@ InversePalindrome.com
 #include "PhysicsSystem.hpp"
 #include "AISystem.hpp"
 #include "CombatSystem.hpp"
+#include "ProjectileSystem.hpp"
 #include "AnimatorSystem.hpp"
 #include "SoundSystem.hpp"
 #include "EffectsSystem.hpp"
@@ -19,12 +20,13 @@ InversePalindrome.com
 #include "ItemsSystem.hpp"
 #include "UnitConverter.hpp"
 #include "EntityUtility.hpp"
+#include "RenderStatistics.hpp"
 
 #include <fstream>
 
 
 EntityManager::EntityManager(b2World& world, ResourceManager& resourceManager, SoundManager& soundManager,
-    InputHandler& inputHandler, CollisionsData& collisionsData, Pathways& pathways) :
+    InputHandler& inputHandler, CollisionsData& collisionsData, CollisionFilter& collisionFilter, Pathways& pathways, NavigationGraph& navigationGraph) :
     world(world),
     componentParser(entityManager, resourceManager, world),
     componentSerializer(entityManager)
@@ -35,11 +37,12 @@ EntityManager::EntityManager(b2World& world, ResourceManager& resourceManager, S
     systems[typeid(ControlSystem).name()] = std::make_unique<ControlSystem>(entityManager, eventManager, inputHandler);
     systems[typeid(StateSystem).name()] = std::make_unique<StateSystem>(entityManager, eventManager);
     systems[typeid(PhysicsSystem).name()] = std::make_unique<PhysicsSystem>(entityManager, eventManager, world, collisionsData);
-    systems[typeid(AISystem).name()] = std::make_unique<AISystem>(entityManager, eventManager, pathways);
-    systems[typeid(CombatSystem).name()] = std::make_unique<CombatSystem>(entityManager, eventManager, componentParser);
-    systems[typeid(AnimatorSystem).name()] = std::make_unique<AnimatorSystem>(entityManager, eventManager);
+    systems[typeid(AISystem).name()] = std::make_unique<AISystem>(entityManager, eventManager, world, pathways, navigationGraph);
+    systems[typeid(ProjectileSystem).name()] = std::make_unique<ProjectileSystem>(entityManager, eventManager, world, componentParser, collisionFilter);
+    systems[typeid(CombatSystem).name()] = std::make_unique<CombatSystem>(entityManager, eventManager, world, componentParser, *this->getSystem<ProjectileSystem>());
+    systems[typeid(AnimatorSystem).name()] = std::make_unique<AnimatorSystem>(entityManager, eventManager, *this->getSystem<RenderSystem>(), activeRegion);
     systems[typeid(SoundSystem).name()] = std::make_unique<SoundSystem>(entityManager, eventManager, soundManager);
-    systems[typeid(EffectsSystem).name()] = std::make_unique<EffectsSystem>(entityManager, eventManager);
+    systems[typeid(EffectsSystem).name()] = std::make_unique<EffectsSystem>(entityManager, eventManager, resourceManager, activeRegion);
     systems[typeid(AutomatorSystem).name()] = std::make_unique<AutomatorSystem>(entityManager, eventManager);
     systems[typeid(ItemsSystem).name()] = std::make_unique<ItemsSystem>(entityManager, eventManager);
 }
@@ -133,6 +136,9 @@ void EntityManager::destroyEntities()
     {
         entity.destroy();
     }
+
+    this->getSystem<ProjectileSystem>()->clearBullets();
+    this->getSystem<EffectsSystem>()->clearParticles();
 }
 
 void EntityManager::saveEntities(const std::string& fileName)
@@ -140,9 +146,36 @@ void EntityManager::saveEntities(const std::string& fileName)
     this->componentSerializer.serialize(fileName);
 }
 
+void EntityManager::setActiveRegion(const sf::FloatRect& activeRegion)
+{
+    this->activeRegion = activeRegion;
+}
+
+void EntityManager::capture(FrameSnapshot& snapshot, const sf::View& view)
+{
+    snapshot.setCaller("RenderSystem");
+    this->getSystem<RenderSystem>()->capture(snapshot, view);
+
+    snapshot.setCaller("EffectsSystem");
+    this->getSystem<EffectsSystem>()->capture(snapshot);
+
+    snapshot.setCaller("ProjectileSystem");
+    this->getSystem<ProjectileSystem>()->capture(snapshot);
+
+    this->getSystem<AnimatorSystem>()->animate(view);
+}
+
 void EntityManager::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
+    Statistics::renderStatistics.setCaller("RenderSystem");
     target.draw(*dynamic_cast<RenderSystem*>(this->systems.at(typeid(RenderSystem).name()).get()));
 
-    dynamic_cast<AnimatorSystem*>(this->systems.at(typeid(AnimatorSystem).name()).get())->animate(target);
+    Statistics::renderStatistics.setCaller("EffectsSystem");
+    target.draw(*dynamic_cast<EffectsSystem*>(this->systems.at(typeid(EffectsSystem).name()).get()));
+
+    Statistics::renderStatistics.setCaller("ProjectileSystem");
+    target.draw(*dynamic_cast<ProjectileSystem*>(this->systems.at(typeid(ProjectileSystem).name()).get()));
+
+    Statistics::renderStatistics.clearCaller();
+    dynamic_cast<AnimatorSystem*>(this->systems.at(typeid(AnimatorSystem).name()).get())->animate(target.getView());
 }
\ No newline at end of file
@@ -0,0 +1,170 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - FramePacer.cpp
+InversePalindrome.com
+*/
+
+
+#include "FramePacer.hpp"
+
+#include <SFML/System/Sleep.hpp>
+
+#include <cmath>
+#include <thread>
+#include <numeric>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+
+
+FramePacer::FramePacer() :
+    framePeriod(Clock::duration::zero()),
+    lastFrame(Clock::now()),
+    frameTimes(),
+    frameCount(0u),
+    workTime(0.f),
+    isTiming(false)
+{
+}
+
+void FramePacer::setFrameRateLimit(unsigned frameRateLimit)
+{
+    this->framePeriod = frameRateLimit > 0u ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / frameRateLimit)) : Clock::duration::zero();
+    this->nextFrame = Clock::now();
+}
+
+void FramePacer::endFrame()
+{
+    const std::chrono::duration<float, std::milli> workTime = Clock::now() - this->lastFrame;
+
+    this->workTime = workTime.count();
+
+    if (this->framePeriod > Clock::duration::zero())
+    {
+        this->nextFrame += this->framePeriod;
+
+        const auto currentTime = Clock::now();
+
+        if (this->nextFrame + this->framePeriod < currentTime)
+        {
+            this->nextFrame = currentTime;
+        }
+        else
+        {
+            this->waitUntil(this->nextFrame);
+        }
+    }
+
+    this->recordFrame(Clock::now());
+}
+
+void FramePacer::idle()
+{
+    const auto idleInterval = std::chrono::milliseconds(16);
+
+    sf::sleep(sf::milliseconds(static_cast<sf::Int32>(idleInterval.count())));
+
+    this->nextFrame = Clock::now();
+    this->lastFrame = this->nextFrame;
+    this->isTiming = false;
+}
+
+float FramePacer::getWorkTime() const
+{
+    return this->workTime;
+}
+
+float FramePacer::getAverageFrameTime() const
+{
+    const auto sampleCount = this->getSampleCount();
+
+    if (sampleCount == 0u)
+    {
+        return 0.f;
+    }
+
+    return std::accumulate(std::begin(this->frameTimes), std::begin(this->frameTimes) + sampleCount, 0.f) / sampleCount;
+}
+
+float FramePacer::getJitter() const
+{
+    const auto sampleCount = this->getSampleCount();
+
+    if (sampleCount == 0u)
+    {
+        return 0.f;
+    }
+
+    const auto averageFrameTime = this->getAverageFrameTime();
+
+    auto variance = 0.f;
+
+    for (std::size_t i = 0u; i < sampleCount; ++i)
+    {
+        variance += (this->frameTimes[i] - averageFrameTime) * (this->frameTimes[i] - averageFrameTime);
+    }
+
+    return std::sqrt(variance / sampleCount);
+}
+
+float FramePacer::getWorstDeviation() const
+{
+    const auto sampleCount = this->getSampleCount();
+    const auto averageFrameTime = this->getAverageFrameTime();
+
+    auto worstDeviation = 0.f;
+
+    for (std::size_t i = 0u; i < sampleCount; ++i)
+    {
+        worstDeviation = std::max(worstDeviation, std::abs(this->frameTimes[i] - averageFrameTime));
+    }
+
+    return worstDeviation;
+}
+
+std::string FramePacer::getSummary() const
+{
+    std::ostringstream summary;
+
+    summary << std::fixed << std::setprecision(2) << "Frame " << this->getAverageFrameTime() << " ms  Jitter " << this->getJitter()
+        << " ms  Worst " << this->getWorstDeviation() << " ms";
+
+    return summary.str();
+}
+
+void FramePacer::waitUntil(Clock::time_point time) const
+{
+    const auto spinMargin = std::chrono::milliseconds(2);
+
+    const auto remainingTime = time - Clock::now();
+
+    if (remainingTime > spinMargin)
+    {
+        sf::sleep(sf::microseconds(static_cast<sf::Int64>(std::chrono::duration_cast<std::chrono::microseconds>(remainingTime - spinMargin).count())));
+    }
+
+    while (Clock::now() < time)
+    {
+        std::this_thread::yield();
+    }
+}
+
+void FramePacer::recordFrame(Clock::time_point time)
+{
+    if (this->isTiming)
+    {
+        const std::chrono::duration<float, std::milli> frameTime = time - this->lastFrame;
+
+        this->frameTimes[this->frameCount % this->frameTimes.size()] = frameTime.count();
+
+        ++this->frameCount;
+    }
+
+    this->lastFrame = time;
+    this->isTiming = true;
+}
+
+std::size_t FramePacer::getSampleCount() const
+{
+    return std::min(this->frameCount, this->frameTimes.size());
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - FrameSnapshot.cpp
+InversePalindrome.com
+*/
+
+
+#include "FrameSnapshot.hpp"
+
+
+void FrameSnapshot::clear()
+{
+    this->commands.clear();
+}
+
+bool FrameSnapshot::isEmpty() const
+{
+    return this->commands.empty();
+}
+
+void FrameSnapshot::setView(const sf::View& view)
+{
+    this->commands.push_back([view](sf::RenderTarget& target) { target.setView(view); });
+}
+
+void FrameSnapshot::setCaller(std::string_view caller)
+{
+    this->commands.push_back([caller](sf::RenderTarget& target) { Statistics::renderStatistics.setCaller(caller); });
+}
+
+void FrameSnapshot::addShared(const sf::Drawable& drawable, const sf::RenderStates& states)
+{
+    this->commands.push_back([&drawable, states](sf::RenderTarget& target) { target.draw(drawable, states); });
+}
+
+void FrameSnapshot::addCommand(std::function<void(sf::RenderTarget&)> command)
+{
+    this->commands.push_back(std::move(command));
+}
+
+void FrameSnapshot::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    for (const auto& command : this->commands)
+    {
+        command(target);
+    }
+}
\ No newline at end of file
@@ -7,6 +7,8 @@ InversePalindrome.com
 
 #include "GUIManager.hpp"
 
+#include <algorithm>
+
 
 GUIManager::GUIManager(sf::RenderWindow& window) :
     window(window)
@@ -45,4 +47,9 @@ void GUIManager::hideAllWidgets()
     {
         widget->Show(false);
     }
+}
+
+bool GUIManager::hasVisibleWidgets() const
+{
+    return std::any_of(std::cbegin(this->widgets), std::cend(this->widgets), [](const auto & widget) { return widget->IsGloballyVisible(); });
 }
\ No newline at end of file
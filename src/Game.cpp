@@ -182,6 +182,29 @@ std::ostream& operator<<(std::ostream & os, const Game & game)
     return os;
 }
 
+std::vector<Game> loadGames(const std::string& fileName)
+{
+    std::ifstream inFile(Path::games / fileName);
+    std::vector<Game> games;
+    std::string gameData;
+    std::string line;
+
+    while (std::getline(inFile, line))
+    {
+        if (line.empty())
+        {
+            games.push_back(Game(gameData));
+            gameData.clear();
+
+            continue;
+        }
+
+        gameData += line + '\n';
+    }
+
+    return games;
+}
+
 void Game::loadLevels()
 {
     std::ifstream inFile(Path::levels / "Levels.txt");
@@ -7,18 +7,24 @@ InversePalindrome.com
 
 #include "GameState.hpp"
 #include "ControlSystem.hpp"
+#include "EffectsSystem.hpp"
+#include "AnimatorSystem.hpp"
+#include "AISystem.hpp"
 #include "StateMachine.hpp"
 #include "FilePaths.hpp"
 #include "UnitConverter.hpp"
 #include "EntityUtility.hpp"
+#include "RenderStatistics.hpp"
+#include "SimulationClock.hpp"
 
 
 GameState::GameState(StateMachine& stateMachine, StateData& stateData) :
     State(stateMachine, stateData),
     world({ 0.f, -9.8f }),
-    entityManager(world, stateData.resourceManager, stateData.soundManager, stateData.inputHandler, collisionsData, pathways),
+    entityManager(world, stateData.resourceManager, stateData.soundManager, stateData.inputHandler, collisionsData, collisionFilter, pathways, navigationGraph),
     map(stateData.games.front(), world, entityManager.getComponentSerializer(), stateData.resourceManager, collisionsData, pathways),
-    camera(stateData.window.getDefaultView()),
+    camera(stateData.defaultView),
+    navigationGraph(world),
     collisionHandler(entityManager.getEvents()),
     collisionFilter(entityManager.getEvents()),
     healthBar(stateData.resourceManager),
@@ -26,10 +32,24 @@ GameState::GameState(StateMachine& stateMachine, StateData& stateData) :
     itemsDisplay(stateData.resourceManager),
     powerUpDisplay(stateData.resourceManager),
     underWaterDisplay(stateData.resourceManager),
-    achievementDisplay(stateData.resourceManager)
+    achievementDisplay(stateData.resourceManager),
+    hudVersion(0u),
+    cachedHUDVersion(0u),
+    hudDirty(true),
+    accumulatedTime(0.f)
 {
     entityManager.copyBlueprint("Player.txt", stateData.games.front().getGameName() + "-Player.txt");
 
+    map.setChunkSize(camera.getSize());
+    map.setTileRenderMode(stateData.graphicsProperties.tileRenderMode);
+    map.setLayerPagesMemory(stateData.graphicsProperties.layerPagesMemory);
+    map.setGraphicsEnabled(!stateData.isHeadless);
+
+    if (stateData.isHeadless)
+    {
+        entityManager.getSystem<AISystem>()->setAgentBudget(64u);
+    }
+
     world.SetContactListener(&collisionHandler);
     world.SetContactFilter(&collisionFilter);
 
@@ -110,9 +130,10 @@ GameState::GameState(StateMachine& stateMachine, StateData& stateData) :
 
             for (const auto& [item, quantity] : stateData.games.front().getItems())
             {
-                itemsDisplay[item].quantity = quantity;
-                itemsDisplay[item].info.setString(std::to_string(quantity) + " / " + std::to_string(itemsDisplay[item].maxQuantity));
+                itemsDisplay.setQuantity(item, quantity);
             }
+
+            invalidateHUD();
         });
 
     entityManager.getEvents().subscribe<entityplus::component_added<Entity, ControllableComponent>>([this](auto& event)
@@ -138,47 +159,105 @@ void GameState::handleEvent(const sf::Event& event)
     else if (this->stateData.inputHandler.isActive(Action::Inventory))
     {
         this->itemsDisplay.setVisibility(!itemsDisplay.getVisibility());
+        this->invalidateHUD();
     }
 }
 
 void GameState::update(float deltaTime)
 {
-    const float timeStep = 1.f / 60.f;
+    this->accumulatedTime += std::min(deltaTime, Simulation::maxFrameTime);
+
+    while (this->accumulatedTime >= Simulation::timeStep)
+    {
+        this->accumulatedTime -= Simulation::timeStep;
+
+        this->step(Simulation::timeStep);
+    }
+}
+
+void GameState::step(float timeStep)
+{
     const std::size_t velocityIterations = 6u;
     const std::size_t positionIterations = 2u;
 
+    Simulation::clock.advance(sf::seconds(timeStep));
+
     this->world.Step(timeStep, velocityIterations, positionIterations);
 
     this->updateCamera();
+    this->applyQualitySettings();
+
+    const auto activeMargin = this->camera.getSize() / 4.f;
+
+    this->entityManager.setActiveRegion({ this->camera.getCenter() - this->camera.getSize() / 2.f - activeMargin, this->camera.getSize() + activeMargin * 2.f });
 
     this->entityManager.getEntities().for_each<TimerComponent>([](auto entity, auto & timer)
         {
             timer.update();
         });
 
-    this->entityManager.update(deltaTime);
-    this->coinDisplay.update(deltaTime);
-    this->itemsDisplay.update(deltaTime);
-    this->powerUpDisplay.update(deltaTime);
+    this->entityManager.update(timeStep);
+    this->coinDisplay.update(timeStep);
+    this->itemsDisplay.update(timeStep);
+    this->powerUpDisplay.update(timeStep);
+
+    const auto isAchievementVisible = this->achievementDisplay.isVisible();
+
     this->achievementDisplay.update();
 
+    if (this->achievementDisplay.isVisible() != isAchievementVisible)
+    {
+        this->invalidateHUD();
+    }
+
     this->callbacks.update();
     this->callbacks.clearCallbacks();
 }
 
 void GameState::draw()
 {
-    this->stateData.window.setView(this->camera);
-    this->stateData.window.draw(this->map);
-    this->stateData.window.draw(this->entityManager);
-
-    this->stateData.window.setView(this->stateData.window.getDefaultView());
-    this->stateData.window.draw(this->healthBar);
-    this->stateData.window.draw(this->coinDisplay);
-    this->stateData.window.draw(this->itemsDisplay);
-    this->stateData.window.draw(this->powerUpDisplay);
-    this->stateData.window.draw(this->underWaterDisplay);
-    this->stateData.window.draw(this->achievementDisplay);
+    this->drawWorld(this->stateData.window, this->camera, this->stateData.graphicsProperties.renderScale, [this](auto & target)
+        {
+            Statistics::renderStatistics.setCaller("Map");
+            target.draw(this->map);
+            target.draw(this->entityManager);
+        });
+
+    this->updateHUDLayer();
+
+    SpriteBatch animations;
+
+    this->batchHUDAnimations(animations);
+
+    this->drawHUD(this->stateData.window, *this->hudLayer, this->hudVersion, std::move(animations));
+}
+
+bool GameState::capture(FrameSnapshot& snapshot)
+{
+    FrameSnapshot world;
+
+    world.setCaller("Map");
+    world.addShared(this->map);
+
+    this->entityManager.capture(world, this->camera);
+
+    snapshot.addCommand([this, world = std::move(world), camera = this->camera, renderScale = this->stateData.graphicsProperties.renderScale](auto & target)
+        {
+            this->drawWorld(target, camera, renderScale, [&world](auto & sceneTarget) { sceneTarget.draw(world); });
+        });
+
+    this->updateHUDLayer();
+
+    SpriteBatch animations;
+
+    this->batchHUDAnimations(animations);
+
+    snapshot.addCommand([this, layer = this->hudLayer, version = this->hudVersion, animations = std::move(animations)](auto & target) mutable
+        {
+            this->drawHUD(target, *layer, version, std::move(animations));
+        });
+
+    return true;
 }
 
 void GameState::showWidgets(bool showStatus)
@@ -187,6 +266,8 @@ void GameState::showWidgets(bool showStatus)
     this->coinDisplay.setVisibilityStatus(showStatus);
 
     this->updateCoinDisplay();
+
+    this->invalidateHUD();
 }
 
 void GameState::updateCamera()
@@ -205,11 +286,11 @@ void GameState::updateCamera()
             }
             else if (centerPosition.x <= this->camera.getSize().x / 2.f)
             {
-                this->camera.setCenter(this->stateData.window.getDefaultView().getCenter());
+                this->camera.setCenter(this->stateData.defaultView.getCenter());
             }
             else
             {
-                this->camera.setCenter(this->map.getBounds().width - this->camera.getSize().x / 2.f, this->stateData.window.getDefaultView().getCenter().y);
+                this->camera.setCenter(this->map.getBounds().width - this->camera.getSize().x / 2.f, this->stateData.defaultView.getCenter().y);
             }
         }
         break;
@@ -221,11 +302,11 @@ void GameState::updateCamera()
             }
             else if (centerPosition.y <= this->camera.getSize().y / 2.f)
             {
-                this->camera.setCenter(this->stateData.window.getDefaultView().getCenter());
+                this->camera.setCenter(this->stateData.defaultView.getCenter());
             }
             else
             {
-                this->camera.setCenter(this->stateData.window.getDefaultView().getCenter().x, this->map.getBounds().height - this->camera.getSize().y / 2.f);
+                this->camera.setCenter(this->stateData.defaultView.getCenter().x, this->map.getBounds().height - this->camera.getSize().y / 2.f);
             }
         }
         break;
@@ -233,6 +314,95 @@ void GameState::updateCamera()
     }
 }
 
+void GameState::applyQualitySettings()
+{
+    const auto& graphicsProperties = this->stateData.graphicsProperties;
+
+    this->entityManager.getSystem<EffectsSystem>()->setEmissionScale(graphicsProperties.particleDensity);
+    this->entityManager.getSystem<AnimatorSystem>()->setLODDistance(graphicsProperties.animationLODDistance);
+    this->entityManager.getSystem<AISystem>()->setTickRateScale(graphicsProperties.aiTickRate);
+}
+
+void GameState::drawWorld(sf::RenderTarget& target, const sf::View& view, float renderScale, const std::function<void(sf::RenderTarget&)>& drawScene)
+{
+    if (renderScale < 1.f && this->resolutionScaler.render(view, renderScale, drawScene))
+    {
+        target.setView(target.getDefaultView());
+
+        Statistics::renderStatistics.setCaller("ResolutionScaler");
+        target.draw(this->resolutionScaler);
+    }
+    else
+    {
+        target.setView(view);
+
+        drawScene(target);
+
+        target.setView(target.getDefaultView());
+    }
+}
+
+void GameState::invalidateHUD()
+{
+    this->hudDirty = true;
+}
+
+void GameState::updateHUDLayer()
+{
+    if (this->hudDirty || !this->hudLayer)
+    {
+        this->hudLayer = std::make_shared<FrameSnapshot>();
+        this->captureHUD(*this->hudLayer);
+
+        ++this->hudVersion;
+        this->hudDirty = false;
+    }
+}
+
+void GameState::captureHUD(FrameSnapshot& snapshot) const
+{
+    snapshot.setCaller("HealthBar");
+    snapshot.add(this->healthBar);
+
+    snapshot.setCaller("CoinDisplay");
+    this->coinDisplay.captureStatic(snapshot);
+
+    snapshot.setCaller("ItemsDisplay");
+    this->itemsDisplay.captureStatic(snapshot);
+
+    snapshot.setCaller("UnderWaterDisplay");
+    snapshot.add(this->underWaterDisplay);
+
+    snapshot.setCaller("AchievementDisplay");
+    this->achievementDisplay.capture(snapshot);
+}
+
+void GameState::batchHUDAnimations(SpriteBatch& animations) const
+{
+    this->coinDisplay.batchAnimations(animations);
+    this->itemsDisplay.batchAnimations(animations);
+    this->powerUpDisplay.batchAnimations(animations);
+}
+
+void GameState::drawHUD(sf::RenderTarget& target, const FrameSnapshot& layer, std::size_t version, SpriteBatch animations)
+{
+    if (version != this->cachedHUDVersion)
+    {
+        this->hudCache.invalidate();
+        this->cachedHUDVersion = version;
+    }
+
+    if (!this->hudCache.render(sf::Vector2u(target.getView().getSize()), [&layer](auto & cacheTarget) { cacheTarget.draw(layer); }))
+    {
+        target.draw(layer);
+    }
+
+    this->hudCache.getAnimations() = std::move(animations);
+
+    Statistics::renderStatistics.setCaller("HUDCache");
+    target.draw(this->hudCache);
+}
+
 void GameState::updateAchievements(Achievement achievement)
 {
     auto& achievements = this->stateData.games.front().getAchievements();
@@ -242,6 +412,7 @@ void GameState::updateAchievements(Achievement achievement)
     if (achievements[achievement].first == achievements[achievement].second)
     {
         this->achievementDisplay.displayAchievement(achievement);
+        this->invalidateHUD();
 
         this->entityManager.getEvents().broadcast(PlaySound{ SoundBuffersID::Achievement });
     }
@@ -250,11 +421,13 @@ void GameState::updateAchievements(Achievement achievement)
 void GameState::updateHealthBar(const HealthComponent & healthComponent)
 {
     this->healthBar.setHitpointsDisplay(healthComponent.getHitpoints());
+    this->invalidateHUD();
 }
 
 void GameState::updateCoinDisplay()
 {
     this->coinDisplay.setNumberOfCoins(this->stateData.games.front().getItems()[Item::Coin]);
+    this->invalidateHUD();
 }
 
 void GameState::updateItemsDisplay(Entity item)
@@ -265,10 +438,8 @@ void GameState::updateItemsDisplay(Entity item)
 
         if (this->itemsDisplay.hasItem(pickup.getItem()))
         {
-            auto& itemData = this->itemsDisplay[pickup.getItem()];
-
-            ++itemData.quantity;
-            itemData.info.setString(std::to_string(itemData.quantity) + " / " + std::to_string(itemData.maxQuantity));
+            this->itemsDisplay.setQuantity(pickup.getItem(), this->itemsDisplay[pickup.getItem()].quantity + 1u);
+            this->invalidateHUD();
         }
     }
 }
@@ -307,6 +478,12 @@ void GameState::updateConversationDisplay(Entity entity)
     }
 }
 
+void GameState::updateUnderWaterDisplay(std::size_t numberOfBubbles)
+{
+    this->underWaterDisplay.setNumberOfBubbles(numberOfBubbles);
+    this->invalidateHUD();
+}
+
 void GameState::displayConversation(Entity entity, bool visibilityStatus)
 {
     if (entity.has_component<DialogComponent>())
@@ -322,6 +499,8 @@ void GameState::changeLevel(const std::string & level, const sf::Vector2f & spaw
     game.setCurrentLevel(level);
     game.setSpawnpoint(spawnpoint);
 
+    this->stateData.renderThread.wait();
+
     this->entityManager.destroyEntities();
 
     this->map.load(level + ".tmx");
@@ -362,6 +541,8 @@ void GameState::changeLevel(const std::string & level, const sf::Vector2f & spaw
         });
 
     this->world.SetGravity(game.getCurrentGravity());
+
+    this->navigationGraph.invalidate();
 }
 
 void GameState::setCheckpoint(const sf::Vector2f & position)
@@ -373,6 +554,11 @@ void GameState::destroyEntity(Entity entity)
 {
     if (entity.sync())
     {
+        if (entity.has_component<PhysicsComponent>() && entity.get_component<PhysicsComponent>().getType() == b2_staticBody)
+        {
+            this->navigationGraph.invalidate();
+        }
+
         this->entityManager.destroyEntity(entity);
 
         if (entity.has_component<ControllableComponent>())
@@ -387,6 +573,11 @@ void GameState::destroyEntity(Entity entity)
 
 void GameState::destroyBody(PhysicsComponent & physics)
 {
+    if (physics.getType() == b2_staticBody)
+    {
+        this->navigationGraph.invalidate();
+    }
+
     this->world.DestroyBody(physics.getBody());
 }
 
@@ -397,7 +588,7 @@ void GameState::manageUnderWaterTimer(Entity entity)
         const float timePerBubble = 1.5f;
         std::size_t numberOfBubbles = 5u;
 
-        this->underWaterDisplay.setNumberOfBubbles(numberOfBubbles);
+        this->updateUnderWaterDisplay(numberOfBubbles);
 
         this->addUnderWaterTimer(entity, numberOfBubbles, timePerBubble);
     }
@@ -411,7 +602,7 @@ void GameState::addUnderWaterTimer(Entity entity, std::size_t numberOfBubbles, f
             {
                 --numberOfBubbles;
 
-                this->underWaterDisplay.setNumberOfBubbles(numberOfBubbles);
+                this->updateUnderWaterDisplay(numberOfBubbles);
 
                 if (!numberOfBubbles)
                 {
@@ -430,12 +621,17 @@ void GameState::removeUnderWaterTimer(Entity entity)
     if (entity.has_component<PhysicsComponent>() && !entity.get_component<PhysicsComponent>().isColliding(ObjectType::Head, ObjectType::Liquid))
     {
         this->callbacks.disconnectCallbackTimers();
-        this->underWaterDisplay.setNumberOfBubbles(0u);
+        this->updateUnderWaterDisplay(0u);
     }
 }
 
 void GameState::saveData(const std::string & fileName)
 {
+    if (this->stateData.isHeadless)
+    {
+        return;
+    }
+
     this->entityManager.saveEntities(this->stateData.games.front().getGameName() + '-' + this->stateData.games.front().getCurrentLevel() + ".txt");
 
     std::ofstream outFile(Path::games / fileName);
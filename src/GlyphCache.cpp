@@ -0,0 +1,73 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - GlyphCache.cpp
+InversePalindrome.com
+*/
+
+
+#include "GlyphCache.hpp"
+
+#include <vector>
+#include <utility>
+
+
+GlyphCache Rendering::glyphCache;
+
+void GlyphCache::setLoadingFence(std::function<void()> loadingFence)
+{
+    this->loadingFence = std::move(loadingFence);
+}
+
+void GlyphCache::prepare(const sf::Text& text)
+{
+    const auto* font = text.getFont();
+
+    if (!font)
+    {
+        return;
+    }
+
+    const auto isBold = (text.getStyle() & sf::Text::Bold) != 0u;
+
+    auto& glyphs = this->preparedGlyphs[std::make_tuple(font, text.getCharacterSize(), isBold, text.getOutlineThickness())];
+
+    std::vector<sf::Uint32> missingGlyphs;
+
+    if (glyphs.empty())
+    {
+        for (sf::Uint32 character = 32u; character < 127u; ++character)
+        {
+            missingGlyphs.push_back(character);
+        }
+    }
+
+    for (auto character : text.getString())
+    {
+        if (!glyphs.count(character))
+        {
+            missingGlyphs.push_back(character);
+        }
+    }
+
+    if (missingGlyphs.empty())
+    {
+        return;
+    }
+
+    if (this->loadingFence)
+    {
+        this->loadingFence();
+    }
+
+    for (auto character : missingGlyphs)
+    {
+        font->getGlyph(character, text.getCharacterSize(), isBold);
+
+        if (text.getOutlineThickness() != 0.f)
+        {
+            font->getGlyph(character, text.getCharacterSize(), isBold, text.getOutlineThickness());
+        }
+
+        glyphs.insert(character);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - GraphicsProperties.cpp
+InversePalindrome.com
+*/
+
+
+#include "GraphicsProperties.hpp"
+#include "FilePaths.hpp"
+
+#include <fstream>
+
+
+GraphicsProperties::GraphicsProperties(const std::string& fileName) :
+    tileRenderMode(TileRenderMode::Vertices),
+    layerPagesMemory(128u),
+    showRenderStatistics(false),
+    threadedRendering(false),
+    framePacing(FramePacing::Capped),
+    frameRateLimit(60u),
+    idleRedraw(true),
+    adaptiveQuality(true),
+    renderScale(1.f),
+    particleDensity(1.f),
+    animationLODDistance(4096.f),
+    aiTickRate(1.f)
+{
+    std::ifstream inFile(Path::miscellaneous / fileName);
+
+    std::size_t renderMode = 0u, pagesMemory = 0u, pacing = 0u;
+    unsigned rateLimit = 0u;
+    bool renderStatistics = false, renderThread = false, idle = false, adaptive = false;
+    float scale = 0.f, density = 0.f, lodDistance = 0.f, tickRate = 0.f;
+
+    if (inFile >> renderMode)
+    {
+        tileRenderMode = TileRenderMode{ renderMode };
+    }
+    if (inFile >> pagesMemory)
+    {
+        layerPagesMemory = pagesMemory;
+    }
+    if (inFile >> renderStatistics)
+    {
+        showRenderStatistics = renderStatistics;
+    }
+    if (inFile >> renderThread)
+    {
+        threadedRendering = renderThread;
+    }
+    if (inFile >> pacing)
+    {
+        framePacing = FramePacing{ pacing };
+    }
+    if (inFile >> rateLimit)
+    {
+        frameRateLimit = rateLimit;
+    }
+    if (inFile >> idle)
+    {
+        idleRedraw = idle;
+    }
+    if (inFile >> adaptive >> scale >> density >> lodDistance >> tickRate)
+    {
+        adaptiveQuality = adaptive;
+        renderScale = scale;
+        particleDensity = density;
+        animationLODDistance = lodDistance;
+        aiTickRate = tickRate;
+    }
+}
+
+void GraphicsProperties::saveData(const std::string& fileName) const
+{
+    std::ofstream outFile(Path::miscellaneous / fileName);
+
+    outFile << static_cast<std::size_t>(this->tileRenderMode) << ' ' << this->layerPagesMemory << ' ' << this->showRenderStatistics << ' ' << this->threadedRendering << ' '
+        << static_cast<std::size_t>(this->framePacing) << ' ' << this->frameRateLimit << ' ' << this->idleRedraw << ' '
+        << this->adaptiveQuality << ' ' << this->renderScale << ' ' << this->particleDensity << ' ' << this->animationLODDistance << ' ' << this->aiTickRate;
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - HUDCache.cpp
+InversePalindrome.com
+*/
+
+
+#include "HUDCache.hpp"
+#include "RenderStatistics.hpp"
+
+
+HUDCache::HUDCache() :
+    failedSize(0u, 0u),
+    valid(false)
+{
+}
+
+bool HUDCache::render(const sf::Vector2u& size, const std::function<void(sf::RenderTarget&)>& drawStatic)
+{
+    if (this->valid)
+    {
+        return true;
+    }
+
+    if (size == this->failedSize)
+    {
+        return false;
+    }
+
+    if (!this->renderTexture || this->renderTexture->getSize() != size)
+    {
+        auto renderTexture = std::make_unique<sf::RenderTexture>();
+
+        if (!renderTexture->create(size.x, size.y))
+        {
+            this->renderTexture.reset();
+            this->failedSize = size;
+
+            return false;
+        }
+
+        this->renderTexture = std::move(renderTexture);
+        this->sprite.setTexture(this->renderTexture->getTexture(), true);
+    }
+
+    this->renderTexture->clear(sf::Color::Transparent);
+
+    drawStatic(*this->renderTexture);
+
+    this->renderTexture->display();
+
+    this->valid = true;
+
+    return true;
+}
+
+void HUDCache::invalidate()
+{
+    this->valid = false;
+}
+
+bool HUDCache::isValid() const
+{
+    return this->valid;
+}
+
+SpriteBatch& HUDCache::getAnimations()
+{
+    return this->animations;
+}
+
+void HUDCache::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    if (this->valid && this->renderTexture)
+    {
+        auto cacheStates = states;
+        cacheStates.blendMode = sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha);
+
+        target.draw(this->sprite, cacheStates);
+
+        Statistics::renderStatistics.recordDraw(this->sprite, cacheStates);
+    }
+
+    Statistics::renderStatistics.setCaller("HUDAnimations");
+    target.draw(this->animations, states);
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - HeadlessApplication.cpp
+InversePalindrome.com
+*/
+
+
+#include "HeadlessApplication.hpp"
+#include "GameState.hpp"
+#include "SimulationClock.hpp"
+
+#include <Thor/Math/Random.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <algorithm>
+
+
+HeadlessApplication::HeadlessApplication(const std::string& gameName, const std::string& level, const std::string& scriptFile) :
+    games(loadGames("SavedGames.txt")),
+    inputScript(scriptFile),
+    resourceManager("ResourcePaths.txt", false),
+    soundManager(resourceManager),
+    graphicsProperties("GraphicsData.txt"),
+    renderThread(window),
+    stateData(games, resourceManager, soundManager, nullptr, inputHandler, graphicsProperties, window, renderThread),
+    stateMachine(stateData)
+{
+    stateData.defaultView.reset({ 0.f, 0.f, 2048.f, 1536.f });
+    stateData.isHeadless = true;
+
+    inputHandler.setScriptedActions({});
+
+    thor::setRandomSeed(0u);
+
+    stateMachine.registerState<GameState>(StateID::Game);
+
+    if (selectGame(gameName, level))
+    {
+        stateMachine.pushState(StateID::Game);
+        stateMachine.update(0.f);
+    }
+}
+
+bool HeadlessApplication::run(std::size_t ticks)
+{
+    if (this->stateMachine.size() == 0u)
+    {
+        return false;
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    for (std::size_t tick = 0u; tick < ticks; ++tick)
+    {
+        this->inputHandler.setScriptedActions(this->inputScript.getActions(tick));
+        this->inputHandler.invokeCallbacks();
+
+        this->stateMachine.update(Simulation::timeStep);
+    }
+
+    const std::chrono::duration<double> elapsedTime = std::chrono::steady_clock::now() - startTime;
+
+    std::cout << ticks << " ticks in " << elapsedTime.count() << "s, " <<
+        (elapsedTime.count() > 0. ? ticks / elapsedTime.count() : 0.) << " ticks per second" << std::endl;
+
+    return true;
+}
+
+bool HeadlessApplication::selectGame(const std::string& gameName, const std::string& level)
+{
+    auto gameIter = std::find_if(std::begin(this->games), std::end(this->games), [&gameName](const auto & game) { return game.getGameName() == gameName; });
+
+    if (gameIter == std::end(this->games))
+    {
+        std::cerr << "Failed to find Game: " + gameName << std::endl;
+
+        return false;
+    }
+
+    std::iter_swap(gameIter, std::begin(this->games));
+
+    if (!level.empty())
+    {
+        if (!this->games.front().getLevels().count(level))
+        {
+            std::cerr << "Failed to find Level: " + level << std::endl;
+
+            return false;
+        }
+
+        this->games.front().setCurrentLevel(level);
+    }
+
+    return true;
+}
\ No newline at end of file
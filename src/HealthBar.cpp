@@ -6,6 +6,7 @@ InversePalindrome.com
 
 
 #include "HealthBar.hpp"
+#include "RenderStatistics.hpp"
 
 
 HealthBar::HealthBar(ResourceManager& resourceManager)
@@ -32,6 +33,8 @@ void HealthBar::draw(sf::RenderTarget& target, sf::RenderStates states) const
         if (this->heart.getTextureRect().width > 0.f)
         {
             target.draw(this->heart, states);
+
+            Statistics::renderStatistics.recordDraw(this->heart, states);
         }
     }
 }
\ No newline at end of file
@@ -11,6 +11,7 @@ InversePalindrome.com
 #include "TextStyleParser.hpp"
 #include "GUIParser.hpp"
 #include "FilePaths.hpp"
+#include "RenderStatistics.hpp"
 
 #include <SFGUI/Label.hpp>
 #include <SFGUI/RadioButton.hpp>
@@ -76,14 +77,14 @@ HubState::HubState(StateMachine& stateMachine, StateData& stateData) :
 
     addGames();
 
-    stateData.guiManager.addWidget(scrolledWindow);
-    stateData.guiManager.addWidget(gamePopupBox);
-    stateData.guiManager.addWidget(backButton);
-    stateData.guiManager.addWidget(playButton);
-    stateData.guiManager.addWidget(addButton);
-    stateData.guiManager.addWidget(deleteButton);
+    stateData.guiManager->addWidget(scrolledWindow);
+    stateData.guiManager->addWidget(gamePopupBox);
+    stateData.guiManager->addWidget(backButton);
+    stateData.guiManager->addWidget(playButton);
+    stateData.guiManager->addWidget(addButton);
+    stateData.guiManager->addWidget(deleteButton);
 
-    Parsers::parseGUIProperties(stateData.guiManager, "HubGUI.txt");
+    Parsers::parseGUIProperties(*stateData.guiManager, "HubGUI.txt");
 }
 
 void HubState::handleEvent(const sf::Event & event)
@@ -98,16 +99,21 @@ void HubState::update(float deltaTime)
 
 void HubState::draw()
 {
-    this->stateData.window.draw(this->titleBar);
-    this->stateData.window.draw(this->title);
+    Statistics::renderStatistics.draw(this->stateData.window, this->titleBar);
+    Statistics::renderStatistics.draw(this->stateData.window, this->title);
 
     if (this->isAddingGame)
     {
-        this->stateData.window.draw(this->addGameBackground);
-        this->stateData.window.draw(this->addGameTitleBar);
+        Statistics::renderStatistics.draw(this->stateData.window, this->addGameBackground);
+        Statistics::renderStatistics.draw(this->stateData.window, this->addGameTitleBar);
     }
 }
 
+bool HubState::isIdle() const
+{
+    return true;
+}
+
 bool HubState::isTransparent() const
 {
     return true;
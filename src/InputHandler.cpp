@@ -9,6 +9,7 @@ InversePalindrome.com
 #include "FilePaths.hpp"
 
 #include <fstream>
+#include <algorithm>
 
 
 InputHandler::InputHandler()
@@ -33,7 +34,17 @@ void InputHandler::update(sf::Window& window)
 
 void InputHandler::invokeCallbacks()
 {
-    this->keyBindings.invokeCallbacks(this->keyCallbacks, nullptr);
+    if (this->scriptedActions)
+    {
+        for (auto action : this->scriptedActions.value())
+        {
+            this->keyCallbacks.triggerEvent(thor::ActionContext<Action>(nullptr, nullptr, action));
+        }
+    }
+    else
+    {
+        this->keyBindings.invokeCallbacks(this->keyCallbacks, nullptr);
+    }
 }
 
 void InputHandler::invokeCallbacks(sf::Window& window)
@@ -61,6 +72,11 @@ bool InputHandler::isActive() const
 
 bool InputHandler::isActive(Action action) const
 {
+    if (this->scriptedActions)
+    {
+        return std::find(std::begin(this->scriptedActions.value()), std::end(this->scriptedActions.value()), action) != std::end(this->scriptedActions.value());
+    }
+
     return this->keyBindings.isActive(action);
 }
 
@@ -80,6 +96,11 @@ void InputHandler::changeKey(Action action, sf::Keyboard::Key key)
     this->keyCodes[action] = { static_cast<std::size_t>(key), 0u };
 }
 
+void InputHandler::setScriptedActions(const std::vector<Action>& actions)
+{
+    this->scriptedActions = actions;
+}
+
 void InputHandler::clearEvents()
 {
     this->keyBindings.clearEvents();
@@ -0,0 +1,53 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - InputScript.cpp
+InversePalindrome.com
+*/
+
+
+#include "InputScript.hpp"
+#include "FilePaths.hpp"
+
+#include <fstream>
+
+
+InputScript::InputScript()
+{
+}
+
+InputScript::InputScript(const std::string& fileName)
+{
+    loadScript(fileName);
+}
+
+void InputScript::loadScript(const std::string& fileName)
+{
+    std::ifstream inFile(Path::miscellaneous / fileName);
+
+    std::size_t firstTick = 0u, lastTick = 0u, actionID = 0u;
+
+    this->scriptedActions.clear();
+
+    while (inFile >> firstTick >> lastTick >> actionID)
+    {
+        if (actionID < static_cast<std::size_t>(Action::Size))
+        {
+            this->scriptedActions.push_back({ firstTick, lastTick, Action{ actionID } });
+        }
+    }
+}
+
+std::vector<Action> InputScript::getActions(std::size_t tick) const
+{
+    std::vector<Action> actions;
+
+    for (const auto& scriptedAction : this->scriptedActions)
+    {
+        if (tick >= scriptedAction.firstTick && tick <= scriptedAction.lastTick)
+        {
+            actions.push_back(scriptedAction.action);
+        }
+    }
+
+    return actions;
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - IntentComponent.cpp
+InversePalindrome.com
+*/
+
+
+#include "IntentComponent.hpp"
+
+
+IntentComponent::IntentComponent() :
+    Component("Intent"),
+    direction(Direction::Right),
+    movementStatus(false),
+    jumpStatus(false)
+{
+}
+
+std::ostream& operator<<(std::ostream& os, const IntentComponent& component)
+{
+    os << component.getEntityID() << ' ' << component.getName();
+
+    return os;
+}
+
+Direction IntentComponent::getDirection() const
+{
+    return this->direction;
+}
+
+void IntentComponent::setDirection(Direction direction)
+{
+    this->direction = direction;
+    this->movementStatus = true;
+}
+
+void IntentComponent::setMovementStatus(bool movementStatus)
+{
+    this->movementStatus = movementStatus;
+}
+
+void IntentComponent::setJumpStatus(bool jumpStatus)
+{
+    this->jumpStatus = jumpStatus;
+}
+
+bool IntentComponent::isMoving() const
+{
+    return this->movementStatus;
+}
+
+bool IntentComponent::isJumping() const
+{
+    return this->jumpStatus;
+}
\ No newline at end of file
@@ -9,6 +9,7 @@ InversePalindrome.com
 #include "FilePaths.hpp"
 #include "AnimationParser.hpp"
 #include "TextStyleParser.hpp"
+#include "RenderStatistics.hpp"
 
 #include <fstream>
 #include <sstream>
@@ -50,6 +51,39 @@ void ItemsDisplay::update(float deltaTime)
     }
 }
 
+void ItemsDisplay::captureStatic(FrameSnapshot& snapshot) const
+{
+    if (this->isVisible)
+    {
+        for (const auto& item : this->itemsData)
+        {
+            snapshot.add(item.second.info, sf::RenderStates(item.second.getTransform()));
+        }
+    }
+}
+
+void ItemsDisplay::batchAnimations(SpriteBatch& spriteBatch) const
+{
+    if (this->isVisible)
+    {
+        for (const auto& item : this->itemsData)
+        {
+            spriteBatch.addSprite(item.second.sprite, item.second.getTransform());
+        }
+    }
+}
+
+void ItemsDisplay::setQuantity(Item item, std::size_t quantity)
+{
+    auto itemData = this->itemsData.find(item);
+
+    if (itemData != std::end(this->itemsData) && itemData->second.quantity != quantity)
+    {
+        itemData->second.quantity = quantity;
+        itemData->second.info.setString(std::to_string(quantity) + " / " + std::to_string(itemData->second.maxQuantity));
+    }
+}
+
 bool ItemsDisplay::getVisibility() const
 {
     return this->isVisible;
@@ -119,6 +153,6 @@ void ItemData::draw(sf::RenderTarget & target, sf::RenderStates states) const
 {
     states.transform = this->getTransform();
 
-    target.draw(this->sprite, states);
-    target.draw(this->info, states);
+    Statistics::renderStatistics.draw(target, this->sprite, states);
+    Statistics::renderStatistics.draw(target, this->info, states);
 }
@@ -18,9 +18,7 @@ ItemsSystem::ItemsSystem(Entities& entities, Events& events) :
 
         collector.get_component<PhysicsComponent>().setMaxVelocity({ maxVelocity.x * (1.f + powerUp.getEffectBoost()), maxVelocity.y * (1.f + powerUp.getEffectBoost()) });
 
-        powerUpTimers.push_back(thor::CallbackTimer());
-
-        powerUpTimers.back().connect0([collector, powerUp, &maxVelocity, &events]() mutable
+        powerUpTimers.addCallbackTimer([collector, powerUp, &maxVelocity, &events]() mutable
             {
                 if (collector.sync())
                 {
@@ -29,9 +27,7 @@ ItemsSystem::ItemsSystem(Entities& entities, Events& events) :
 
                     events.broadcast(HidePowerUp{ powerUp.getItem() });
                 }
-            });
-
-        powerUpTimers.back().restart(sf::seconds(powerUp.getEffectTime()));
+            }, powerUp.getEffectTime());
 
         events.broadcast(DisplayPowerUp{ powerUp.getItem() });
     };
@@ -42,9 +38,7 @@ ItemsSystem::ItemsSystem(Entities& entities, Events& events) :
 
         collector.get_component<PhysicsComponent>().setJumpVelocity(jumpVelocity * (1.f + powerUp.getEffectBoost()));
 
-        powerUpTimers.push_back(thor::CallbackTimer());
-
-        powerUpTimers.back().connect0([collector, powerUp, &jumpVelocity, &events]() mutable
+        powerUpTimers.addCallbackTimer([collector, powerUp, &jumpVelocity, &events]() mutable
             {
                 if (collector.sync())
                 {
@@ -53,9 +47,7 @@ ItemsSystem::ItemsSystem(Entities& entities, Events& events) :
 
                     events.broadcast(HidePowerUp{ powerUp.getItem() });
                 }
-            });
-
-        powerUpTimers.back().restart(sf::seconds(powerUp.getEffectTime()));
+            }, powerUp.getEffectTime());
 
         events.broadcast(DisplayPowerUp{ powerUp.getItem() });
     };
@@ -64,9 +56,7 @@ ItemsSystem::ItemsSystem(Entities& entities, Events& events) :
     {
         collector.add_component<RangeAttackComponent>("Laser", powerUp.getEffectBoost());
 
-        powerUpTimers.push_back(thor::CallbackTimer());
-
-        powerUpTimers.back().connect0([collector, powerUp, &events]() mutable
+        powerUpTimers.addCallbackTimer([collector, powerUp, &events]() mutable
             {
                 if (collector.sync())
                 {
@@ -75,9 +65,7 @@ ItemsSystem::ItemsSystem(Entities& entities, Events& events) :
 
                     events.broadcast(HidePowerUp{ powerUp.getItem() });
                 }
-            });
-
-        powerUpTimers.back().restart(sf::seconds(powerUp.getEffectTime()));
+            }, powerUp.getEffectTime());
 
         events.broadcast(DisplayPowerUp{ powerUp.getItem() });
     };
@@ -102,19 +90,7 @@ ItemsSystem::ItemsSystem(Entities& entities, Events& events) :
 
 void ItemsSystem::update(float deltaTime)
 {
-    for (auto powerUpTimer = std::begin(this->powerUpTimers); powerUpTimer != std::end(this->powerUpTimers); )
-    {
-        powerUpTimer->update();
-
-        if (powerUpTimer->isExpired())
-        {
-            powerUpTimer = this->powerUpTimers.erase(powerUpTimer);
-        }
-        else
-        {
-            ++powerUpTimer;
-        }
-    }
+    this->powerUpTimers.update();
 
     this->callbacks.update();
     this->callbacks.clearCallbacks();
@@ -0,0 +1,122 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - KinematicPath.cpp
+InversePalindrome.com
+*/
+
+
+#include "KinematicPath.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+
+KinematicPath::KinematicPath() :
+    loopIndex(0u),
+    duration(0.f)
+{
+}
+
+void KinematicPath::compile(const std::vector<Task>& tasks, const b2Vec2& origin, const b2Vec2& halfExtent, const b2Vec2& maxVelocity)
+{
+    this->segments.clear();
+    this->duration = 0.f;
+
+    auto position = origin;
+
+    this->addSegments(tasks, halfExtent, maxVelocity, position);
+
+    this->loopIndex = this->segments.size();
+
+    this->addSegments(tasks, halfExtent, maxVelocity, position);
+}
+
+b2Vec2 KinematicPath::getPosition(float time) const
+{
+    if (this->segments.empty())
+    {
+        return { 0.f, 0.f };
+    }
+
+    if (time >= this->duration)
+    {
+        if (this->loopIndex < this->segments.size())
+        {
+            const auto loopStartTime = this->segments[this->loopIndex].startTime;
+
+            time = loopStartTime + std::fmod(time - loopStartTime, this->duration - loopStartTime);
+        }
+        else
+        {
+            time = this->duration;
+        }
+    }
+
+    auto segment = std::upper_bound(std::cbegin(this->segments), std::cend(this->segments), time,
+        [](auto time, const auto& segment) { return time < segment.startTime; });
+
+    if (segment != std::cbegin(this->segments))
+    {
+        --segment;
+    }
+
+    const auto elapsedTime = time - segment->startTime;
+
+    return { segment->origin.x + segment->velocity.x * elapsedTime, segment->origin.y + segment->velocity.y * elapsedTime };
+}
+
+float KinematicPath::getDuration() const
+{
+    return this->duration;
+}
+
+bool KinematicPath::isEmpty() const
+{
+    return this->segments.empty();
+}
+
+void KinematicPath::addSegments(const std::vector<Task>& tasks, const b2Vec2& halfExtent, const b2Vec2& maxVelocity, b2Vec2& position)
+{
+    for (const auto& [direction, destination] : tasks)
+    {
+        auto target = position;
+        auto segmentDuration = 0.f;
+
+        switch (direction)
+        {
+        case Direction::Right:
+            target.x = std::max(position.x, destination.x - halfExtent.x);
+            break;
+        case Direction::Left:
+            target.x = std::min(position.x, destination.x + halfExtent.x);
+            break;
+        case Direction::Up:
+            target.y = std::max(position.y, destination.y - halfExtent.y);
+            break;
+        case Direction::Down:
+            target.y = std::min(position.y, destination.y + halfExtent.y);
+            break;
+        default:
+            target = destination;
+            break;
+        }
+
+        if (target.x != position.x && maxVelocity.x > 0.f)
+        {
+            segmentDuration = std::abs(target.x - position.x) / maxVelocity.x;
+        }
+        if (target.y != position.y && maxVelocity.y > 0.f)
+        {
+            segmentDuration = std::max(segmentDuration, std::abs(target.y - position.y) / maxVelocity.y);
+        }
+
+        if (segmentDuration > 0.f)
+        {
+            this->segments.push_back({ position, { (target.x - position.x) / segmentDuration, (target.y - position.y) / segmentDuration }, this->duration });
+
+            this->duration += segmentDuration;
+
+            position = target;
+        }
+    }
+}
\ No newline at end of file
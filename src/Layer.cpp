@@ -8,20 +8,33 @@ InversePalindrome.com
 #include "Layer.hpp"
 #include "FilePaths.hpp"
 
+#include <cmath>
+#include <algorithm>
 
-Layer::Layer(const tmx::Map& map, std::size_t layerID, const sf::Vector2f& layerSize) :
-    size(layerSize)
+
+Layer::Layer(const tmx::Map& map, std::size_t layerID, const sf::Vector2f& chunkSize, TileRenderMode renderMode) :
+    size(chunkSize)
 {
     const auto& layers = map.getLayers();
 
     const auto& tileSize = map.getTileSize();
-    size.x = std::floor(size.x / tileSize.x) * tileSize.x;
-    size.y = std::floor(size.y / tileSize.y) * tileSize.y;
+    size.x = std::max(std::floor(size.x / tileSize.x), 1.f) * tileSize.x;
+    size.y = std::max(std::floor(size.y / tileSize.y), 1.f) * tileSize.y;
 
     const auto & layer = layers[layerID].get();
 
     if (layer->getType() == tmx::Layer::Type::Tile)
     {
+        if (renderMode == TileRenderMode::Shader)
+        {
+            tileShader = std::make_unique<sf::Shader>();
+
+            if (!ShaderChunkTiles::loadShader(*tileShader))
+            {
+                tileShader.reset();
+            }
+        }
+
         createChunks(map, *dynamic_cast<tmx::TileLayer*>(layer));
     }
 
@@ -103,33 +116,34 @@ void Layer::createChunks(const tmx::Map& map, const tmx::TileLayer& layer)
         for (auto x = 0u; x < this->chunkCount.x; ++x)
         {
             this->chunks.emplace_back(std::make_unique<Chunk>(layer, usedTileSets,
-                sf::Vector2f(x * this->size.x, y * this->size.y), tileCount, map.getTileCount().x, this->textures));
+                sf::Vector2f(x * this->size.x, y * this->size.y), tileCount, map.getTileCount().x, this->textures, this->tileShader.get()));
         }
     }
 }
 
 void Layer::updateVisibility(const sf::View& view) const
 {
-    sf::Vector2f viewCorner = view.getCenter();
-    viewCorner -= view.getSize() / 2.f;
+    this->visibleChunks.clear();
 
-    int posX = static_cast<int>(std::floor(viewCorner.x / this->size.x));
-    int posY = static_cast<int>(std::floor(viewCorner.y / this->size.y));
+    const auto viewCorner = view.getCenter() - view.getSize() / 2.f;
+    const auto chunkCountX = static_cast<int>(this->chunkCount.x);
+    const auto chunkCountY = static_cast<int>(this->chunkCount.y);
 
-    std::vector<const Chunk*> visible;
+    const auto firstX = std::clamp(static_cast<int>(std::floor(viewCorner.x / this->size.x)), 0, chunkCountX);
+    const auto firstY = std::clamp(static_cast<int>(std::floor(viewCorner.y / this->size.y)), 0, chunkCountY);
+    const auto lastX = std::clamp(static_cast<int>(std::ceil((viewCorner.x + view.getSize().x) / this->size.x)), 0, chunkCountX);
+    const auto lastY = std::clamp(static_cast<int>(std::ceil((viewCorner.y + view.getSize().y) / this->size.y)), 0, chunkCountY);
 
-    for (auto y = posY; y < posY + 2; ++y)
+    for (auto y = firstY; y < lastY; ++y)
     {
-        for (auto x = posX; x < posX + 2; ++x)
+        for (auto x = firstX; x < lastX; ++x)
         {
-            auto id = y * this->chunkCount.x + x;
+            const auto& chunk = this->chunks[y * chunkCountX + x];
 
-            if (id >= 0 && id < this->chunks.size() && !this->chunks.at(id)->isEmpty())
+            if (!chunk->isEmpty())
             {
-                visible.push_back(this->chunks[id].get());
+                this->visibleChunks.push_back(chunk.get());
             }
         }
     }
-
-    std::swap(this->visibleChunks, visible);
 }
\ No newline at end of file
@@ -0,0 +1,113 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - LayerPages.cpp
+InversePalindrome.com
+*/
+
+
+#include "LayerPages.hpp"
+#include "RenderStatistics.hpp"
+
+#include <SFML/Graphics/View.hpp>
+
+#include <cmath>
+#include <algorithm>
+
+
+bool LayerPages::render(const sf::Drawable& background, const std::vector<std::unique_ptr<Layer>>& layers,
+    const sf::FloatRect& bounds, const sf::Vector2f& pageSize, std::size_t memoryLimit)
+{
+    this->clear();
+
+    const auto maxTextureSize = static_cast<float>(sf::Texture::getMaximumSize());
+
+    this->pageSize = { std::min(std::ceil(pageSize.x), maxTextureSize), std::min(std::ceil(pageSize.y), maxTextureSize) };
+
+    if (this->pageSize.x <= 0.f || this->pageSize.y <= 0.f)
+    {
+        return false;
+    }
+
+    this->pageCount = { static_cast<unsigned>(std::ceil(bounds.width / this->pageSize.x)), static_cast<unsigned>(std::ceil(bounds.height / this->pageSize.y)) };
+
+    const auto pageMemory = static_cast<std::size_t>(this->pageSize.x) * static_cast<std::size_t>(this->pageSize.y) * 4u;
+
+    if (static_cast<std::size_t>(this->pageCount.x) * this->pageCount.y * pageMemory > memoryLimit)
+    {
+        return false;
+    }
+
+    for (auto y = 0u; y < this->pageCount.y; ++y)
+    {
+        for (auto x = 0u; x < this->pageCount.x; ++x)
+        {
+            auto page = std::make_unique<sf::RenderTexture>();
+
+            if (!page->create(static_cast<unsigned>(this->pageSize.x), static_cast<unsigned>(this->pageSize.y)))
+            {
+                this->clear();
+
+                return false;
+            }
+
+            const sf::Vector2f pagePosition(x * this->pageSize.x, y * this->pageSize.y);
+
+            page->setView(sf::View(sf::FloatRect(pagePosition, this->pageSize)));
+            page->clear(sf::Color::Transparent);
+            page->draw(background);
+
+            for (const auto& layer : layers)
+            {
+                page->draw(*layer);
+            }
+
+            page->display();
+
+            this->pageSprites.emplace_back(page->getTexture());
+            this->pageSprites.back().setPosition(pagePosition);
+
+            this->pages.push_back(std::move(page));
+        }
+    }
+
+    return true;
+}
+
+void LayerPages::clear()
+{
+    this->pageSprites.clear();
+    this->pages.clear();
+    this->pageCount = { 0u, 0u };
+}
+
+bool LayerPages::isRendered() const
+{
+    return !this->pages.empty();
+}
+
+void LayerPages::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    const auto& view = target.getView();
+    const auto viewCorner = view.getCenter() - view.getSize() / 2.f;
+    const auto pageCountX = static_cast<int>(this->pageCount.x);
+    const auto pageCountY = static_cast<int>(this->pageCount.y);
+
+    const auto firstX = std::clamp(static_cast<int>(std::floor(viewCorner.x / this->pageSize.x)), 0, pageCountX);
+    const auto firstY = std::clamp(static_cast<int>(std::floor(viewCorner.y / this->pageSize.y)), 0, pageCountY);
+    const auto lastX = std::clamp(static_cast<int>(std::ceil((viewCorner.x + view.getSize().x) / this->pageSize.x)), 0, pageCountX);
+    const auto lastY = std::clamp(static_cast<int>(std::ceil((viewCorner.y + view.getSize().y) / this->pageSize.y)), 0, pageCountY);
+
+    states.blendMode = sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha);
+
+    for (auto y = firstY; y < lastY; ++y)
+    {
+        for (auto x = firstX; x < lastX; ++x)
+        {
+            const auto& pageSprite = this->pageSprites[y * pageCountX + x];
+
+            target.draw(pageSprite, states);
+
+            Statistics::renderStatistics.recordDraw(pageSprite, states);
+        }
+    }
+}
\ No newline at end of file
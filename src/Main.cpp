@@ -6,10 +6,37 @@ InversePalindrome.com
 
 
 #include "Application.hpp"
+#include "HeadlessApplication.hpp"
 
+#include <string>
+#include <cctype>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
 
-int main()
+
+int main(int argc, char* argv[])
 {
+    if (argc > 1 && std::string(argv[1]) == "--headless")
+    {
+        const std::string ticksArgument(argc > 4 ? argv[4] : "");
+
+        std::istringstream iStream(ticksArgument);
+        std::size_t ticks = 0u;
+
+        if (argc < 5 || ticksArgument.empty() || !std::all_of(std::begin(ticksArgument), std::end(ticksArgument), [](unsigned char c) { return std::isdigit(c); }) ||
+            !(iStream >> ticks))
+        {
+            std::cerr << "Usage: Nihil --headless <game> <level|-> <ticks> [script]" << std::endl;
+
+            return EXIT_FAILURE;
+        }
+
+        HeadlessApplication app(argv[2], std::string(argv[3]) == "-" ? "" : argv[3], argc > 5 ? argv[5] : "");
+
+        return app.run(ticks) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
     Application app;
 
     app.run();
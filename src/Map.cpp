@@ -8,6 +8,7 @@ InversePalindrome.com
 #include "Map.hpp"
 #include "FilePaths.hpp"
 #include "UnitConverter.hpp"
+#include "RenderStatistics.hpp"
 
 #include <Box2D/Dynamics/b2Body.h>
 #include <Box2D/Dynamics/b2Fixture.h>
@@ -22,6 +23,9 @@ InversePalindrome.com
 
 Map::Map(Game& game, b2World& world, ComponentSerializer& componentSerializer, ResourceManager& resourceManager,
     CollisionsData& collisionsData, Pathways& pathways) :
+    tileRenderMode(TileRenderMode::Vertices),
+    layerPagesMemory(128u),
+    graphicsEnabled(true),
     game(game),
     world(world),
     componentSerializer(componentSerializer),
@@ -33,6 +37,7 @@ Map::Map(Game& game, b2World& world, ComponentSerializer& componentSerializer, R
 
 void Map::load(const std::string& fileName)
 {
+    this->layerPages.clear();
     this->layers.clear();
     this->pathways.clear();
 
@@ -40,12 +45,42 @@ void Map::load(const std::string& fileName)
     this->fileName = Path::levels / fileName;
     this->bounds = { this->map.getBounds().left, this->map.getBounds().top, this->map.getBounds().width, this->map.getBounds().height };
 
-    for (std::size_t i = 0; i < this->map.getLayers().size(); ++i)
+    if (this->graphicsEnabled)
     {
-        this->layers.push_back(std::make_unique<Layer>(this->map, i, sf::Vector2f(this->bounds.width, this->bounds.height)));
+        for (std::size_t i = 0; i < this->map.getLayers().size(); ++i)
+        {
+            this->layers.push_back(std::make_unique<Layer>(this->map, i, this->getChunkSize(), this->tileRenderMode));
+        }
     }
 
     this->parseMap();
+
+    if (this->graphicsEnabled)
+    {
+        this->layerPages.render(this->background, this->layers, this->bounds, this->getChunkSize(), this->layerPagesMemory * 1024u * 1024u);
+    }
+
+    this->pathways.build();
+}
+
+void Map::setChunkSize(const sf::Vector2f& chunkSize)
+{
+    this->chunkSize = chunkSize;
+}
+
+void Map::setTileRenderMode(TileRenderMode tileRenderMode)
+{
+    this->tileRenderMode = tileRenderMode;
+}
+
+void Map::setLayerPagesMemory(std::size_t megabytes)
+{
+    this->layerPagesMemory = megabytes;
+}
+
+void Map::setGraphicsEnabled(bool graphicsEnabled)
+{
+    this->graphicsEnabled = graphicsEnabled;
 }
 
 void Map::parseMap()
@@ -55,7 +90,10 @@ void Map::parseMap()
         switch (layer->getType())
         {
         case tmx::Layer::Type::Image:
-            this->addImage(dynamic_cast<tmx::ImageLayer*>(layer.get()));
+            if (this->graphicsEnabled)
+            {
+                this->addImage(dynamic_cast<tmx::ImageLayer*>(layer.get()));
+            }
             break;
         case tmx::Layer::Type::Object:
             this->addObjects(dynamic_cast<tmx::ObjectGroup*>(layer.get()));
@@ -74,6 +112,16 @@ std::string Map::getCurrentFilePath() const
     return this->fileName;
 }
 
+sf::Vector2f Map::getChunkSize() const
+{
+    if (this->chunkSize.x > 0.f && this->chunkSize.y > 0.f)
+    {
+        return this->chunkSize;
+    }
+
+    return { this->bounds.width, this->bounds.height };
+}
+
 void Map::addImage(tmx::ImageLayer* imageLayer)
 {
     auto backgroundID = static_cast<TexturesID>(imageLayer->getProperties().back().getIntValue());
@@ -195,16 +243,11 @@ void Map::addObjects(tmx::ObjectGroup* objectLayer)
                 {
                     std::istringstream iStream(property.second.getStringValue());
 
-                    std::size_t pathwayIndex = 0u, waypointStep = 0u;
+                    std::size_t pathwayID = 0u, waypointStep = 0u;
 
-                    iStream >> pathwayIndex >> waypointStep;
+                    iStream >> pathwayID >> waypointStep;
 
-                    if (!this->pathways.count(pathwayIndex))
-                    {
-                        this->pathways.emplace(pathwayIndex, Pathway());
-                    }
-
-                    this->pathways[pathwayIndex].addWaypoint(Waypoint(
+                    this->pathways.addWaypoint(pathwayID, Waypoint(
                         { object.getPosition().x + AABB.width / 2.f, object.getPosition().y + AABB.height / 2.f }, waypointStep));
                 }
             }
@@ -225,8 +268,17 @@ void Map::addObjects(tmx::ObjectGroup* objectLayer)
 
 void Map::draw(sf::RenderTarget & target, sf::RenderStates states) const
 {
+    if (this->layerPages.isRendered())
+    {
+        target.draw(this->layerPages, states);
+
+        return;
+    }
+
     target.draw(this->background);
 
+    Statistics::renderStatistics.recordDraw(this->background, sf::RenderStates::Default);
+
     for (const auto& layer : this->layers)
     {
         layer->draw(target, states);
@@ -11,8 +11,7 @@ InversePalindrome.com
 #include "GUIParser.hpp"
 #include "EffectParser.hpp"
 #include "TextStyleParser.hpp"
-
-#include <Thor/Particles/Emitters.hpp>
+#include "RenderStatistics.hpp"
 
 
 MenuState::MenuState(StateMachine& stateMachine, StateData& stateData) :
@@ -21,6 +20,9 @@ MenuState::MenuState(StateMachine& stateMachine, StateData& stateData) :
     playButton(sfg::Button::Create("       Play       ")),
     settingsButton(sfg::Button::Create("    Settings   ")),
     quitButton(sfg::Button::Create("       Quit        ")),
+    particleEngine(stateData.resourceManager),
+    particleEmitter(Parsers::parseEmitter("MenuEmitters.txt")),
+    particlePool(particleEngine.getPool("MenuParticles.txt")),
     isTitleVisible(true)
 {
     stateData.window.setView(stateData.window.getDefaultView());
@@ -41,16 +43,13 @@ MenuState::MenuState(StateMachine& stateMachine, StateData& stateData) :
     quitButton->SetPosition({ 740.f, 1180.f });
     quitButton->GetSignal(sfg::Widget::OnLeftClick).Connect([&stateData] { stateData.window.close(); });
 
-    Parsers::parseGUIProperties(stateData.guiManager, "MenuGUI.txt");
+    Parsers::parseGUIProperties(*stateData.guiManager, "MenuGUI.txt");
 
-    stateData.guiManager.addWidget(playButton);
-    stateData.guiManager.addWidget(settingsButton);
-    stateData.guiManager.addWidget(quitButton);
+    stateData.guiManager->addWidget(playButton);
+    stateData.guiManager->addWidget(settingsButton);
+    stateData.guiManager->addWidget(quitButton);
 
     stateData.soundManager.playMusic("MenuMusic.wav", true);
-
-    Parsers::parseParticleSystem(stateData.resourceManager, "MenuParticles.txt", particleSystem);
-    particleSystem.addEmitter(Parsers::parseEmitter("MenuEmitters.txt"));
 }
 
 void MenuState::handleEvent(const sf::Event & event)
@@ -60,17 +59,18 @@ void MenuState::handleEvent(const sf::Event & event)
 
 void MenuState::update(float deltaTime)
 {
-    this->particleSystem.update(sf::seconds(deltaTime));
+    this->particleEngine.emit(this->particlePool, this->particleEmitter, { 0.f, 0.f }, deltaTime);
+    this->particleEngine.update(deltaTime);
 }
 
 void MenuState::draw()
 {
-    this->stateData.window.draw(this->background);
-    this->stateData.window.draw(this->particleSystem);
+    Statistics::renderStatistics.draw(this->stateData.window, this->background);
+    this->stateData.window.draw(this->particleEngine);
 
     if (this->isTitleVisible)
     {
-        this->stateData.window.draw(this->titleLabel);
+        Statistics::renderStatistics.draw(this->stateData.window, this->titleLabel);
     }
 }
 
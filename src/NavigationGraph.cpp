@@ -0,0 +1,327 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - NavigationGraph.cpp
+InversePalindrome.com
+*/
+
+
+#include "NavigationGraph.hpp"
+#include "CollisionData.hpp"
+#include "UnitConverter.hpp"
+#include "MathUtility.hpp"
+
+#include <Box2D/Dynamics/b2Body.h>
+#include <Box2D/Dynamics/b2Fixture.h>
+
+#include <queue>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <functional>
+
+
+NavigationGraph::NavigationGraph(b2World& world) :
+    world(world),
+    dirtyStatus(true)
+{
+}
+
+const NavigationPath* NavigationGraph::findPath(const sf::Vector2f& origin, const sf::Vector2f& destination, float jumpVelocity, float maxVelocity)
+{
+    const auto originSurface = this->getSurface(origin);
+    const auto destinationSurface = this->getSurface(destination);
+
+    if (!originSurface || !destinationSurface)
+    {
+        return nullptr;
+    }
+
+    const Archetype archetype(jumpVelocity, maxVelocity);
+    const auto key = std::make_tuple(archetype, originSurface.value(), destinationSurface.value());
+
+    auto cachedPath = this->cachedPaths.find(key);
+
+    if (cachedPath == std::end(this->cachedPaths))
+    {
+        cachedPath = this->cachedPaths.emplace(key, this->searchPath(originSurface.value(), destinationSurface.value(), this->getLinks(archetype))).first;
+    }
+
+    return cachedPath->second ? &cachedPath->second.value() : nullptr;
+}
+
+std::optional<std::size_t> NavigationGraph::getSurface(const sf::Vector2f& position)
+{
+    if (this->dirtyStatus)
+    {
+        this->build();
+    }
+
+    const auto edgeMargin = 8.f;
+
+    std::optional<std::size_t> closestSurface;
+    auto minDistance = std::numeric_limits<float>::max();
+
+    for (std::size_t i = 0u; i < this->surfaces.size(); ++i)
+    {
+        const auto& surface = this->surfaces[i];
+        const auto distance = surface.height - position.y;
+
+        if (position.x >= surface.left - edgeMargin && position.x <= surface.right + edgeMargin && distance >= 0.f && distance < minDistance)
+        {
+            closestSurface = i;
+            minDistance = distance;
+        }
+    }
+
+    return closestSurface;
+}
+
+void NavigationGraph::invalidate()
+{
+    this->dirtyStatus = true;
+}
+
+void NavigationGraph::build()
+{
+    this->surfaces.clear();
+    this->archetypeLinks.clear();
+    this->cachedPaths.clear();
+
+    this->addSurfaces();
+
+    this->dirtyStatus = false;
+}
+
+void NavigationGraph::addSurfaces()
+{
+    const auto minWidth = 4.f;
+    const auto joinTolerance = 1.f;
+
+    std::vector<NavigationSurface> blockSurfaces;
+
+    for (const auto* body = this->world.GetBodyList(); body; body = body->GetNext())
+    {
+        if (body->GetType() != b2_staticBody)
+        {
+            continue;
+        }
+
+        for (const auto* fixture = body->GetFixtureList(); fixture; fixture = fixture->GetNext())
+        {
+            const auto* collisionData = static_cast<const CollisionData*>(fixture->GetUserData());
+
+            if (fixture->IsSensor() || !collisionData || !(collisionData->objectType & ObjectType::Block))
+            {
+                continue;
+            }
+
+            for (int32 child = 0; child < fixture->GetShape()->GetChildCount(); ++child)
+            {
+                b2AABB AABB;
+                fixture->GetShape()->ComputeAABB(&AABB, body->GetTransform(), child);
+
+                const auto left = UnitConverter::metersToPixels(AABB.lowerBound.x);
+                const auto right = UnitConverter::metersToPixels(AABB.upperBound.x);
+
+                if (right - left >= minWidth)
+                {
+                    blockSurfaces.push_back({ left, right, UnitConverter::metersToPixels(-AABB.upperBound.y) });
+                }
+            }
+        }
+    }
+
+    std::sort(std::begin(blockSurfaces), std::end(blockSurfaces), [](const auto & surface1, const auto & surface2)
+        {
+            return std::tie(surface1.height, surface1.left) < std::tie(surface2.height, surface2.left);
+        });
+
+    for (const auto& surface : blockSurfaces)
+    {
+        if (!this->surfaces.empty() && std::abs(this->surfaces.back().height - surface.height) < joinTolerance &&
+            surface.left <= this->surfaces.back().right + joinTolerance)
+        {
+            this->surfaces.back().right = std::max(this->surfaces.back().right, surface.right);
+        }
+        else
+        {
+            this->surfaces.push_back(surface);
+        }
+    }
+}
+
+const NavigationGraph::Links& NavigationGraph::getLinks(const Archetype& archetype)
+{
+    if (auto links = this->archetypeLinks.find(archetype); links != std::end(this->archetypeLinks))
+    {
+        return links->second;
+    }
+
+    Links links(this->surfaces.size());
+
+    for (std::size_t from = 0u; from < this->surfaces.size(); ++from)
+    {
+        for (std::size_t to = 0u; to < this->surfaces.size(); ++to)
+        {
+            if (from != to)
+            {
+                if (const auto link = this->createLink(from, to, archetype))
+                {
+                    links[from].push_back(link.value());
+                }
+            }
+        }
+    }
+
+    return this->archetypeLinks.emplace(archetype, std::move(links)).first->second;
+}
+
+std::optional<NavigationLink> NavigationGraph::createLink(std::size_t from, std::size_t to, const Archetype& archetype) const
+{
+    const auto edgeMargin = 8.f;
+    const auto stepHeight = 4.f;
+
+    const auto& origin = this->surfaces[from];
+    const auto& destination = this->surfaces[to];
+
+    const auto gravity = UnitConverter::metersToPixels(std::abs(this->world.GetGravity().y));
+    const auto jumpVelocity = UnitConverter::metersToPixels(archetype.first);
+    const auto horizontalVelocity = UnitConverter::metersToPixels(archetype.second);
+    const auto rise = origin.height - destination.height;
+
+    sf::Vector2f departure, arrival;
+    auto gap = edgeMargin;
+
+    if (destination.left >= origin.right)
+    {
+        departure = { origin.right, origin.height };
+        arrival = { destination.left, destination.height };
+        gap = destination.left - origin.right;
+    }
+    else if (destination.right <= origin.left)
+    {
+        departure = { origin.left, origin.height };
+        arrival = { destination.right, destination.height };
+        gap = origin.left - destination.right;
+    }
+    else if (rise > 0.f && origin.left < destination.left - edgeMargin)
+    {
+        departure = { destination.left - edgeMargin, origin.height };
+        arrival = { destination.left, destination.height };
+    }
+    else if (rise > 0.f && origin.right > destination.right + edgeMargin)
+    {
+        departure = { destination.right + edgeMargin, origin.height };
+        arrival = { destination.right, destination.height };
+    }
+    else if (rise < 0.f && destination.left < origin.left - edgeMargin)
+    {
+        departure = { origin.left, origin.height };
+        arrival = { origin.left - edgeMargin, destination.height };
+    }
+    else if (rise < 0.f && destination.right > origin.right + edgeMargin)
+    {
+        departure = { origin.right, origin.height };
+        arrival = { origin.right + edgeMargin, destination.height };
+    }
+    else
+    {
+        return {};
+    }
+
+    const auto distance = Utility::distance(departure, arrival);
+
+    if (std::abs(rise) <= stepHeight && gap <= edgeMargin)
+    {
+        return NavigationLink{ to, NavigationLinkType::Walk, departure, arrival, distance };
+    }
+
+    if (gravity <= 0.f)
+    {
+        return {};
+    }
+
+    if (rise < 0.f && gap <= horizontalVelocity * std::sqrt(2.f * -rise / gravity) + edgeMargin)
+    {
+        return NavigationLink{ to, NavigationLinkType::Drop, departure, arrival, distance };
+    }
+
+    const auto discriminant = jumpVelocity * jumpVelocity - 2.f * gravity * rise;
+
+    if (discriminant >= 0.f && gap <= horizontalVelocity * (jumpVelocity + std::sqrt(discriminant)) / gravity)
+    {
+        const auto jumpPenalty = 2.f;
+
+        return NavigationLink{ to, NavigationLinkType::Jump, departure, arrival, distance * jumpPenalty };
+    }
+
+    return {};
+}
+
+std::optional<NavigationPath> NavigationGraph::searchPath(std::size_t origin, std::size_t destination, const Links& links) const
+{
+    using Node = std::pair<float, std::size_t>;
+
+    std::vector<float> costs(this->surfaces.size(), std::numeric_limits<float>::max());
+    std::vector<const NavigationLink*> previousLinks(this->surfaces.size(), nullptr);
+    std::vector<std::size_t> previousSurfaces(this->surfaces.size(), origin);
+    std::vector<bool> visited(this->surfaces.size(), false);
+
+    std::priority_queue<Node, std::vector<Node>, std::greater<Node>> openSurfaces;
+
+    costs[origin] = 0.f;
+    openSurfaces.push({ this->estimateCost(origin, destination), origin });
+
+    while (!openSurfaces.empty())
+    {
+        const auto current = openSurfaces.top().second;
+        openSurfaces.pop();
+
+        if (current == destination)
+        {
+            NavigationPath path;
+
+            for (auto surface = destination; surface != origin; surface = previousSurfaces[surface])
+            {
+                path.push_back(*previousLinks[surface]);
+            }
+
+            std::reverse(std::begin(path), std::end(path));
+
+            return path;
+        }
+
+        if (visited[current])
+        {
+            continue;
+        }
+
+        visited[current] = true;
+
+        for (const auto& link : links[current])
+        {
+            const auto cost = costs[current] + link.cost;
+
+            if (cost < costs[link.surface])
+            {
+                costs[link.surface] = cost;
+                previousLinks[link.surface] = &link;
+                previousSurfaces[link.surface] = current;
+
+                openSurfaces.push({ cost + this->estimateCost(link.surface, destination), link.surface });
+            }
+        }
+    }
+
+    return {};
+}
+
+float NavigationGraph::estimateCost(std::size_t from, std::size_t to) const
+{
+    const auto& origin = this->surfaces[from];
+    const auto& destination = this->surfaces[to];
+
+    const auto gap = std::max({ 0.f, destination.left - origin.right, origin.left - destination.right });
+
+    return std::sqrt(gap * gap + (origin.height - destination.height) * (origin.height - destination.height));
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - NullSoundManager.cpp
+InversePalindrome.com
+*/
+
+
+#include "NullSoundManager.hpp"
+
+
+NullSoundManager::NullSoundManager(ResourceManager& resourceManager) :
+    SoundManager(resourceManager)
+{
+}
+
+void NullSoundManager::playSound(SoundBuffersID soundBufferID, bool loop)
+{
+}
+
+void NullSoundManager::playMusic(const std::string& name, bool loop)
+{
+}
+
+void NullSoundManager::setListenerPosition(const sf::Vector3f& position)
+{
+}
+
+void NullSoundManager::setListenerDirection(const sf::Vector3f& direction)
+{
+}
\ No newline at end of file
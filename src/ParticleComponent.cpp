@@ -8,19 +8,14 @@ InversePalindrome.com
 #include "ParticleComponent.hpp"
 #include "EffectParser.hpp"
 
-#include <Thor/Math/Distributions.hpp>
 
-
-ParticleComponent::ParticleComponent(ResourceManager& resourceManager, const sf::Vector2f& effectRange,
-    const std::string& particleFile, const std::string& emitterFile) :
+ParticleComponent::ParticleComponent(const sf::Vector2f& effectRange, const std::string& particleFile, const std::string& emitterFile) :
     Component("Particle"),
     effectRange(effectRange),
     particleFile(particleFile),
-    emitterFile(emitterFile)
+    emitterFile(emitterFile),
+    emitter(Parsers::parseEmitter(emitterFile))
 {
-    Parsers::parseParticleSystem(resourceManager, particleFile, particleSystem);
-
-    particleSystem.addEmitter(Parsers::parseEmitter(emitterFile));
 }
 
 std::ostream& operator<<(std::ostream& os, const ParticleComponent& component)
@@ -31,19 +26,22 @@ std::ostream& operator<<(std::ostream& os, const ParticleComponent& component)
     return os;
 }
 
-void ParticleComponent::update(float deltaTime)
+void ParticleComponent::update(ParticleEngine& particleEngine, bool isActive, float deltaTime)
 {
-    this->particleSystem.update(sf::seconds(deltaTime));
+    if (!this->poolIndex)
+    {
+        this->poolIndex = particleEngine.addAnchor(this->particleFile);
+    }
+
+    particleEngine.moveAnchor(this->poolIndex.value(), this->getPosition(), isActive);
+
+    if (isActive)
+    {
+        particleEngine.emit(this->poolIndex.value(), this->emitter, { 0.f, 0.f }, deltaTime);
+    }
 }
 
 sf::FloatRect ParticleComponent::getGlobalBounds() const
 {
     return { this->getPosition(), { this->effectRange.x, this->effectRange.y } };
-}
-
-void ParticleComponent::draw(sf::RenderTarget& target, sf::RenderStates states) const
-{
-    states.transform *= this->getTransform();
-
-    target.draw(this->particleSystem, states);
 }
\ No newline at end of file
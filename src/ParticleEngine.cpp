@@ -0,0 +1,450 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - ParticleEngine.cpp
+InversePalindrome.com
+*/
+
+
+#include "ParticleEngine.hpp"
+#include "EffectParser.hpp"
+
+#include <SFML/Graphics/Transform.hpp>
+
+#include <array>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NIHIL_PARTICLE_SSE
+#include <emmintrin.h>
+#endif
+
+
+ParticleEngine::ParticleEngine(ResourceManager& resourceManager) :
+    resourceManager(resourceManager),
+    emittingPool(nullptr),
+    emissionScale(1.f),
+    updateStamp(0u)
+{
+}
+
+std::size_t ParticleEngine::getPool(const std::string& particleFile)
+{
+    if (auto poolIndex = this->poolIndices.find(particleFile); poolIndex != std::end(this->poolIndices))
+    {
+        return poolIndex->second;
+    }
+
+    return this->poolIndices.emplace(particleFile, this->addPool(particleFile, false)).first->second;
+}
+
+std::size_t ParticleEngine::addAnchor(const std::string& particleFile)
+{
+    return this->addPool(particleFile, true);
+}
+
+void ParticleEngine::moveAnchor(std::size_t poolIndex, const sf::Vector2f& position, bool isActive)
+{
+    auto& pool = this->pools[poolIndex];
+
+    pool.anchor = position;
+    pool.isActive = isActive;
+    pool.updateStamp = this->updateStamp;
+}
+
+void ParticleEngine::releaseStaleAnchors()
+{
+    for (std::size_t poolIndex = 0u; poolIndex < this->pools.size(); ++poolIndex)
+    {
+        const auto& pool = this->pools[poolIndex];
+
+        if (pool.isAnchored && !pool.isFree && pool.updateStamp != this->updateStamp)
+        {
+            this->releaseAnchor(poolIndex);
+        }
+    }
+
+    ++this->updateStamp;
+}
+
+void ParticleEngine::emit(std::size_t poolIndex, thor::UniversalEmitter& emitter, const sf::Vector2f& position, float deltaTime)
+{
+    this->emittingPool = &this->pools[poolIndex];
+    this->emittingPosition = position;
+
+    emitter(*this, sf::seconds(deltaTime * this->emissionScale));
+
+    this->emittingPool = nullptr;
+}
+
+void ParticleEngine::update(float deltaTime)
+{
+    for (auto& pool : this->pools)
+    {
+        if (!pool.isActive)
+        {
+            continue;
+        }
+
+        this->integrate(pool, deltaTime);
+        this->removeExpired(pool);
+
+        for (const auto& affector : this->properties[pool.propertiesIndex].affectors)
+        {
+            this->applyAffector(pool, affector, deltaTime);
+        }
+    }
+
+    this->updateBatches();
+}
+
+void ParticleEngine::clear()
+{
+    for (std::size_t poolIndex = 0u; poolIndex < this->pools.size(); ++poolIndex)
+    {
+        auto& pool = this->pools[poolIndex];
+
+        if (pool.isAnchored && !pool.isFree)
+        {
+            this->releaseAnchor(poolIndex);
+        }
+        else
+        {
+            this->clearPool(pool);
+        }
+    }
+
+    this->spriteBatch.clear();
+}
+
+void ParticleEngine::setEmissionScale(float emissionScale)
+{
+    this->emissionScale = std::max(emissionScale, 0.f);
+}
+
+std::size_t ParticleEngine::getParticleCount() const
+{
+    std::size_t particleCount = 0u;
+
+    for (const auto& pool : this->pools)
+    {
+        particleCount += pool.size();
+    }
+
+    return particleCount;
+}
+
+std::size_t ParticleEngine::ParticlePool::size() const
+{
+    return this->xPositions.size();
+}
+
+void ParticleEngine::emitParticle(const thor::Particle& particle)
+{
+    auto& pool = *this->emittingPool;
+
+    pool.xPositions.push_back(this->emittingPosition.x + particle.position.x);
+    pool.yPositions.push_back(this->emittingPosition.y + particle.position.y);
+    pool.xVelocities.push_back(particle.velocity.x);
+    pool.yVelocities.push_back(particle.velocity.y);
+    pool.rotations.push_back(particle.rotation);
+    pool.rotationSpeeds.push_back(particle.rotationSpeed);
+    pool.xScales.push_back(particle.scale.x);
+    pool.yScales.push_back(particle.scale.y);
+    pool.reds.push_back(particle.color.r);
+    pool.greens.push_back(particle.color.g);
+    pool.blues.push_back(particle.color.b);
+    pool.alphas.push_back(particle.color.a);
+    pool.elapsedLifetimes.push_back(thor::getElapsedLifetime(particle).asSeconds());
+    pool.totalLifetimes.push_back(thor::getTotalLifetime(particle).asSeconds());
+    pool.textureIndices.push_back(particle.textureIndex);
+}
+
+std::size_t ParticleEngine::getProperties(const std::string& particleFile)
+{
+    if (auto propertiesIndex = this->propertiesIndices.find(particleFile); propertiesIndex != std::end(this->propertiesIndices))
+    {
+        return propertiesIndex->second;
+    }
+
+    this->properties.push_back(Parsers::parseParticleProperties(this->resourceManager, particleFile));
+
+    return this->propertiesIndices.emplace(particleFile, this->properties.size() - 1u).first->second;
+}
+
+std::size_t ParticleEngine::addPool(const std::string& particleFile, bool isAnchored)
+{
+    std::size_t poolIndex = this->pools.size();
+
+    if (isAnchored && !this->freeAnchors.empty())
+    {
+        poolIndex = this->freeAnchors.back();
+        this->freeAnchors.pop_back();
+    }
+    else
+    {
+        this->pools.emplace_back();
+    }
+
+    auto& pool = this->pools[poolIndex];
+
+    pool.propertiesIndex = this->getProperties(particleFile);
+    pool.anchor = { 0.f, 0.f };
+    pool.updateStamp = this->updateStamp;
+    pool.isAnchored = isAnchored;
+    pool.isActive = true;
+    pool.isFree = false;
+
+    return poolIndex;
+}
+
+void ParticleEngine::releaseAnchor(std::size_t poolIndex)
+{
+    auto& pool = this->pools[poolIndex];
+
+    this->clearPool(pool);
+
+    pool.isActive = false;
+    pool.isFree = true;
+
+    this->freeAnchors.push_back(poolIndex);
+}
+
+void ParticleEngine::clearPool(ParticlePool& pool)
+{
+    for (auto* values : { &pool.xPositions, &pool.yPositions, &pool.xVelocities, &pool.yVelocities, &pool.rotations, &pool.rotationSpeeds,
+        &pool.xScales, &pool.yScales, &pool.reds, &pool.greens, &pool.blues, &pool.alphas, &pool.elapsedLifetimes, &pool.totalLifetimes })
+    {
+        values->clear();
+    }
+
+    pool.textureIndices.clear();
+}
+
+void ParticleEngine::integrate(ParticlePool& pool, float deltaTime)
+{
+    this->addConstant(pool.elapsedLifetimes, deltaTime);
+    this->addScaled(pool.xPositions, pool.xVelocities, deltaTime);
+    this->addScaled(pool.yPositions, pool.yVelocities, deltaTime);
+    this->addScaled(pool.rotations, pool.rotationSpeeds, deltaTime);
+}
+
+void ParticleEngine::removeExpired(ParticlePool& pool)
+{
+    for (std::size_t index = 0u; index < pool.size(); )
+    {
+        if (pool.elapsedLifetimes[index] < pool.totalLifetimes[index])
+        {
+            ++index;
+            continue;
+        }
+
+        for (auto* values : { &pool.xPositions, &pool.yPositions, &pool.xVelocities, &pool.yVelocities, &pool.rotations, &pool.rotationSpeeds,
+            &pool.xScales, &pool.yScales, &pool.reds, &pool.greens, &pool.blues, &pool.alphas, &pool.elapsedLifetimes, &pool.totalLifetimes })
+        {
+            (*values)[index] = values->back();
+            values->pop_back();
+        }
+
+        pool.textureIndices[index] = pool.textureIndices.back();
+        pool.textureIndices.pop_back();
+    }
+}
+
+void ParticleEngine::computeProgresses(const ParticlePool& pool)
+{
+    this->progresses.resize(pool.size());
+
+    std::size_t index = 0u;
+
+#ifdef NIHIL_PARTICLE_SSE
+    for (; index + 4u <= pool.size(); index += 4u)
+    {
+        _mm_storeu_ps(&this->progresses[index], _mm_div_ps(_mm_loadu_ps(&pool.elapsedLifetimes[index]), _mm_loadu_ps(&pool.totalLifetimes[index])));
+    }
+#endif
+
+    for (; index < pool.size(); ++index)
+    {
+        this->progresses[index] = pool.elapsedLifetimes[index] / pool.totalLifetimes[index];
+    }
+}
+
+void ParticleEngine::applyAffector(ParticlePool& pool, const ParticleAffector& affector, float deltaTime)
+{
+    switch (affector.type)
+    {
+    case AffectorType::Force:
+        this->addConstant(pool.xVelocities, affector.values.x * deltaTime);
+        this->addConstant(pool.yVelocities, affector.values.y * deltaTime);
+        break;
+    case AffectorType::Scale:
+        this->addConstant(pool.xScales, affector.values.x * deltaTime);
+        this->addConstant(pool.yScales, affector.values.y * deltaTime);
+        break;
+    case AffectorType::Torque:
+        this->addConstant(pool.rotationSpeeds, affector.values.x * deltaTime);
+        break;
+    case AffectorType::Fade:
+        this->applyFade(pool, affector.values.x, affector.values.y);
+        break;
+    case AffectorType::Color:
+        this->applyColors(pool, affector.colors);
+        break;
+    }
+}
+
+void ParticleEngine::applyFade(ParticlePool& pool, float fadeInRatio, float fadeOutRatio)
+{
+    this->computeProgresses(pool);
+
+    const auto fadeInScale = fadeInRatio > 0.f ? 255.f / fadeInRatio : 0.f;
+    const auto fadeOutScale = fadeOutRatio > 0.f ? 255.f / fadeOutRatio : 0.f;
+
+    std::size_t index = 0u;
+
+#ifdef NIHIL_PARTICLE_SSE
+    const auto one = _mm_set1_ps(1.f);
+    const auto maxAlpha = _mm_set1_ps(255.f);
+    const auto fadeIn = _mm_set1_ps(fadeInRatio);
+    const auto fadeOut = _mm_set1_ps(1.f - fadeOutRatio);
+    const auto fadeInMultiplier = _mm_set1_ps(fadeInScale);
+    const auto fadeOutMultiplier = _mm_set1_ps(fadeOutScale);
+
+    for (; index + 4u <= pool.size(); index += 4u)
+    {
+        const auto progress = _mm_loadu_ps(&this->progresses[index]);
+        const auto alpha = _mm_loadu_ps(&pool.alphas[index]);
+
+        const auto isFadingIn = _mm_cmplt_ps(progress, fadeIn);
+        const auto isFadingOut = _mm_andnot_ps(isFadingIn, _mm_cmpgt_ps(progress, fadeOut));
+
+        const auto fadeInAlpha = _mm_min_ps(_mm_mul_ps(progress, fadeInMultiplier), maxAlpha);
+        const auto fadeOutAlpha = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(one, progress), fadeOutMultiplier), maxAlpha);
+
+        const auto isUnchanged = _mm_andnot_ps(_mm_or_ps(isFadingIn, isFadingOut), alpha);
+
+        _mm_storeu_ps(&pool.alphas[index], _mm_or_ps(isUnchanged,
+            _mm_or_ps(_mm_and_ps(isFadingIn, fadeInAlpha), _mm_and_ps(isFadingOut, fadeOutAlpha))));
+    }
+#endif
+
+    for (; index < pool.size(); ++index)
+    {
+        const auto progress = this->progresses[index];
+
+        if (progress < fadeInRatio)
+        {
+            pool.alphas[index] = std::min(progress * fadeInScale, 255.f);
+        }
+        else if (progress > 1.f - fadeOutRatio)
+        {
+            pool.alphas[index] = std::min((1.f - progress) * fadeOutScale, 255.f);
+        }
+    }
+}
+
+void ParticleEngine::applyColors(ParticlePool& pool, const thor::ColorGradient& colors)
+{
+    this->computeProgresses(pool);
+
+    for (std::size_t index = 0u; index < pool.size(); ++index)
+    {
+        const auto color = colors.sampleColor(std::min(this->progresses[index], 1.f));
+
+        pool.reds[index] = color.r;
+        pool.greens[index] = color.g;
+        pool.blues[index] = color.b;
+        pool.alphas[index] = color.a;
+    }
+}
+
+void ParticleEngine::addScaled(std::vector<float>& values, const std::vector<float>& rates, float deltaTime)
+{
+    std::size_t index = 0u;
+
+#ifdef NIHIL_PARTICLE_SSE
+    const auto scale = _mm_set1_ps(deltaTime);
+
+    for (; index + 4u <= values.size(); index += 4u)
+    {
+        _mm_storeu_ps(&values[index], _mm_add_ps(_mm_loadu_ps(&values[index]), _mm_mul_ps(_mm_loadu_ps(&rates[index]), scale)));
+    }
+#endif
+
+    for (; index < values.size(); ++index)
+    {
+        values[index] += rates[index] * deltaTime;
+    }
+}
+
+void ParticleEngine::addConstant(std::vector<float>& values, float constant)
+{
+    std::size_t index = 0u;
+
+#ifdef NIHIL_PARTICLE_SSE
+    const auto increment = _mm_set1_ps(constant);
+
+    for (; index + 4u <= values.size(); index += 4u)
+    {
+        _mm_storeu_ps(&values[index], _mm_add_ps(_mm_loadu_ps(&values[index]), increment));
+    }
+#endif
+
+    for (; index < values.size(); ++index)
+    {
+        values[index] += constant;
+    }
+}
+
+void ParticleEngine::updateBatches()
+{
+    this->spriteBatch.clear();
+
+    for (const auto& pool : this->pools)
+    {
+        const auto* texture = this->properties[pool.propertiesIndex].texture;
+        const auto& textureRects = this->properties[pool.propertiesIndex].textureRects;
+
+        if (!pool.isActive || !texture)
+        {
+            continue;
+        }
+
+        const sf::IntRect fullRect(0, 0, static_cast<int>(texture->getSize().x), static_cast<int>(texture->getSize().y));
+
+        for (std::size_t index = 0u; index < pool.size(); ++index)
+        {
+            const auto& textureRect = pool.textureIndices[index] < textureRects.size() ? textureRects[pool.textureIndices[index]] : fullRect;
+
+            const auto halfWidth = textureRect.width / 2.f;
+            const auto halfHeight = textureRect.height / 2.f;
+
+            const auto left = static_cast<float>(textureRect.left);
+            const auto right = left + textureRect.width;
+            const auto top = static_cast<float>(textureRect.top);
+            const auto bottom = top + textureRect.height;
+
+            sf::Transform transform;
+            transform.translate(pool.anchor.x + pool.xPositions[index], pool.anchor.y + pool.yPositions[index]).rotate(pool.rotations[index]).scale(pool.xScales[index], pool.yScales[index]);
+
+            const sf::Color color(static_cast<sf::Uint8>(pool.reds[index]), static_cast<sf::Uint8>(pool.greens[index]),
+                static_cast<sf::Uint8>(pool.blues[index]), static_cast<sf::Uint8>(std::clamp(pool.alphas[index], 0.f, 255.f)));
+
+            this->spriteBatch.addQuad(*texture, { {
+                { transform.transformPoint(-halfWidth, -halfHeight), color, { left, top } },
+                { transform.transformPoint(halfWidth, -halfHeight), color, { right, top } },
+                { transform.transformPoint(halfWidth, halfHeight), color, { right, bottom } },
+                { transform.transformPoint(-halfWidth, halfHeight), color, { left, bottom } } } });
+        }
+    }
+}
+
+void ParticleEngine::capture(FrameSnapshot& snapshot) const
+{
+    snapshot.add(this->spriteBatch);
+}
+
+void ParticleEngine::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    target.draw(this->spriteBatch, states);
+}
\ No newline at end of file
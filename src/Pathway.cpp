@@ -21,24 +21,38 @@ bool Waypoint::operator<(const Waypoint& rhs) const
     return this->step < rhs.step;
 }
 
-Pathway::Pathway() :
-    currentWaypointIndex(0u)
+Pathway::Pathway(const Waypoint* waypoints, std::size_t numberOfWaypoints) :
+    waypoints(waypoints),
+    numberOfWaypoints(numberOfWaypoints),
+    range(0.f, 0.f)
 {
+    if (numberOfWaypoints)
+    {
+        auto rangeElements = std::minmax_element(waypoints, waypoints + numberOfWaypoints,
+            [](const auto & waypoint1, const auto & waypoint2) { return waypoint1.point.x < waypoint2.point.x; });
+
+        this->range = { rangeElements.first->point.x, rangeElements.second->point.x };
+    }
+}
+
+const Waypoint& Pathway::operator[](std::size_t index) const
+{
+    return this->waypoints[index];
 }
 
-std::vector<Waypoint> Pathway::getWaypoints() const
+const Waypoint* Pathway::begin() const
 {
     return this->waypoints;
 }
 
-Waypoint Pathway::getCurrentWaypoint() const
+const Waypoint* Pathway::end() const
 {
-    return this->waypoints[this->currentWaypointIndex];
+    return this->waypoints + this->numberOfWaypoints;
 }
 
-std::size_t Pathway::getCurrentWaypointIndex() const
+std::size_t Pathway::size() const
 {
-    return this->currentWaypointIndex;
+    return this->numberOfWaypoints;
 }
 
 std::pair<float, float> Pathway::getRange() const
@@ -46,42 +60,72 @@ std::pair<float, float> Pathway::getRange() const
     return this->range;
 }
 
-void Pathway::setCurrentWaypointIndex(std::size_t currentWaypointIndex)
+bool Pathway::hasWaypoints() const
 {
-    this->currentWaypointIndex = currentWaypointIndex;
+    return this->numberOfWaypoints > 0u;
 }
 
-void Pathway::moveToNextWaypoint()
+const Pathway& Pathways::operator[](std::size_t pathwayIndex) const
 {
-    if (this->waypoints.size() > 1u)
-    {
-        ++this->currentWaypointIndex;
-
-        if (this->currentWaypointIndex == this->waypoints.size())
-        {
-            this->currentWaypointIndex = 1u;
+    return this->pathways[pathwayIndex];
+}
 
-            std::reverse(std::begin(this->waypoints), std::end(this->waypoints));
-        }
+std::optional<std::size_t> Pathways::getPathwayIndex(std::size_t pathwayID) const
+{
+    if (auto pathwayItr = this->pathwayIndices.find(pathwayID); pathwayItr != std::cend(this->pathwayIndices))
+    {
+        return pathwayItr->second;
     }
+
+    return {};
 }
 
-void Pathway::addWaypoint(const Waypoint& waypoint)
+void Pathways::addWaypoint(std::size_t pathwayID, const Waypoint& waypoint)
 {
-    this->waypoints.push_back(waypoint);
+    this->pendingWaypoints.push_back({ pathwayID, waypoint });
 }
 
-void Pathway::sortWaypoints()
+void Pathways::build()
 {
-    std::sort(std::begin(this->waypoints), std::end(this->waypoints));
+    std::stable_sort(std::begin(this->pendingWaypoints), std::end(this->pendingWaypoints),
+        [](const auto & waypoint1, const auto & waypoint2)
+        {
+            return waypoint1.first < waypoint2.first || (waypoint1.first == waypoint2.first && waypoint1.second < waypoint2.second);
+        });
+
+    this->waypoints.clear();
+    this->pathways.clear();
+    this->pathwayIndices.clear();
+
+    this->waypoints.reserve(this->pendingWaypoints.size());
+
+    for (const auto& [pathwayID, waypoint] : this->pendingWaypoints)
+    {
+        this->waypoints.push_back(waypoint);
+    }
+
+    for (std::size_t first = 0u; first < this->pendingWaypoints.size();)
+    {
+        auto last = first;
+
+        while (last < this->pendingWaypoints.size() && this->pendingWaypoints[last].first == this->pendingWaypoints[first].first)
+        {
+            ++last;
+        }
 
-    auto rangeElements = std::minmax_element(std::cbegin(this->waypoints), std::cend(this->waypoints),
-        [](const auto & waypoint1, const auto & waypoint2) { return waypoint1.point.x < waypoint2.point.x; });
+        this->pathwayIndices.emplace(this->pendingWaypoints[first].first, this->pathways.size());
+        this->pathways.push_back(Pathway(this->waypoints.data() + first, last - first));
 
-    this->range = { rangeElements.first->point.x, rangeElements.second->point.x };
+        first = last;
+    }
+
+    this->pendingWaypoints.clear();
 }
 
-bool Pathway::hasWaypoints() const
+void Pathways::clear()
 {
-    return !this->waypoints.empty();
+    this->pendingWaypoints.clear();
+    this->waypoints.clear();
+    this->pathways.clear();
+    this->pathwayIndices.clear();
 }
\ No newline at end of file
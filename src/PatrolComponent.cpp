@@ -10,7 +10,9 @@ InversePalindrome.com
 
 
 PatrolComponent::PatrolComponent() :
-    Component("Patrol")
+    Component("Patrol"),
+    currentWaypointIndex(0u),
+    reversedStatus(false)
 {
 }
 
@@ -21,47 +23,60 @@ std::ostream& operator<<(std::ostream& os, const PatrolComponent& component)
     return os;
 }
 
-Waypoint PatrolComponent::operator[](std::size_t index)
+std::size_t PatrolComponent::getPathwayIndex() const
 {
-    return this->pathway.getWaypoints()[index];
-}
-
-Pathway PatrolComponent::getPathway() const
-{
-    return this->pathway;
-}
-
-Waypoint PatrolComponent::getCurrentWaypoint() const
-{
-    return this->pathway.getCurrentWaypoint();
+    return this->pathwayIndex.value();
 }
 
 std::size_t PatrolComponent::getCurrentWaypointIndex() const
 {
-    return this->pathway.getCurrentWaypointIndex();
-}
-
-std::pair<float, float> PatrolComponent::getRange() const
-{
-    return this->pathway.getRange();
+    return this->currentWaypointIndex;
 }
 
-void PatrolComponent::setPathway(const Pathway& pathway)
+void PatrolComponent::setPathwayIndex(std::size_t pathwayIndex)
 {
-    this->pathway = pathway;
+    this->pathwayIndex = pathwayIndex;
+    this->currentWaypointIndex = 0u;
+    this->reversedStatus = false;
 }
 
 void PatrolComponent::setCurrentWaypointIndex(std::size_t currentWaypointIndex)
 {
-    this->pathway.setCurrentWaypointIndex(currentWaypointIndex);
+    this->currentWaypointIndex = currentWaypointIndex;
 }
 
-void PatrolComponent::moveToNextWaypoint()
+void PatrolComponent::moveToNextWaypoint(std::size_t numberOfWaypoints)
 {
-    this->pathway.moveToNextWaypoint();
+    if (numberOfWaypoints > 1u)
+    {
+        if (!this->reversedStatus)
+        {
+            if (this->currentWaypointIndex + 1u >= numberOfWaypoints)
+            {
+                this->reversedStatus = true;
+                this->currentWaypointIndex = numberOfWaypoints - 2u;
+            }
+            else
+            {
+                ++this->currentWaypointIndex;
+            }
+        }
+        else
+        {
+            if (this->currentWaypointIndex == 0u)
+            {
+                this->reversedStatus = false;
+                this->currentWaypointIndex = 1u;
+            }
+            else
+            {
+                --this->currentWaypointIndex;
+            }
+        }
+    }
 }
 
-bool PatrolComponent::hasWaypoints() const
+bool PatrolComponent::hasPathway() const
 {
-    return this->pathway.hasWaypoints();
+    return this->pathwayIndex.has_value();
 }
\ No newline at end of file
@@ -10,6 +10,7 @@ InversePalindrome.com
 #include "StateMachine.hpp"
 #include "SpriteParser.hpp"
 #include "TextStyleParser.hpp"
+#include "RenderStatistics.hpp"
 
 
 PauseState::PauseState(StateMachine& stateMachine, StateData& stateData) :
@@ -64,11 +65,11 @@ PauseState::PauseState(StateMachine& stateMachine, StateData& stateData) :
             transitionToMenu();
         });
 
-    stateData.guiManager.addWidget(resumeButton);
-    stateData.guiManager.addWidget(shopButton);
-    stateData.guiManager.addWidget(achievementsButton);
-    stateData.guiManager.addWidget(settingsButton);
-    stateData.guiManager.addWidget(quitButton);
+    stateData.guiManager->addWidget(resumeButton);
+    stateData.guiManager->addWidget(shopButton);
+    stateData.guiManager->addWidget(achievementsButton);
+    stateData.guiManager->addWidget(settingsButton);
+    stateData.guiManager->addWidget(quitButton);
 }
 
 void PauseState::handleEvent(const sf::Event& event)
@@ -87,12 +88,17 @@ void PauseState::draw()
 {
     if (this->isBackgroundVisible)
     {
-        this->stateData.window.draw(this->background);
-        this->stateData.window.draw(this->titleBar);
-        this->stateData.window.draw(this->title);
+        Statistics::renderStatistics.draw(this->stateData.window, this->background);
+        Statistics::renderStatistics.draw(this->stateData.window, this->titleBar);
+        Statistics::renderStatistics.draw(this->stateData.window, this->title);
     }
 }
 
+bool PauseState::isIdle() const
+{
+    return true;
+}
+
 bool PauseState::isTransparent() const
 {
     return true;
@@ -0,0 +1,151 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - Perception.cpp
+InversePalindrome.com
+*/
+
+
+#include "Perception.hpp"
+#include "MathUtility.hpp"
+#include "CollisionData.hpp"
+#include "UnitConverter.hpp"
+
+#include <Box2D/Dynamics/b2Body.h>
+#include <Box2D/Dynamics/b2Fixture.h>
+
+#include <algorithm>
+
+
+Perception::Perception(b2World& world, std::size_t cacheDuration) :
+    world(world),
+    currentFrame(0u),
+    cacheDuration(cacheDuration),
+    queryType(ObjectType::Player),
+    occludedStatus(false)
+{
+}
+
+void Perception::beginFrame()
+{
+    ++this->currentFrame;
+}
+
+const PerceivedTargets& Perception::perceive(std::int32_t observerID, const sf::Vector2f& position, float range, ObjectType targetType)
+{
+    auto& cachedPerception = this->cachedPerceptions[observerID];
+
+    if (cachedPerception.frame != 0u && this->currentFrame - cachedPerception.frame < this->cacheDuration &&
+        cachedPerception.range == range && cachedPerception.targetType == targetType)
+    {
+        this->refreshTargets(cachedPerception.targets, position, range);
+
+        return cachedPerception.targets;
+    }
+
+    this->candidates.clear();
+    this->candidateBodies.clear();
+    this->queryType = targetType;
+
+    b2AABB AABB;
+    AABB.lowerBound = { UnitConverter::pixelsToMeters(position.x - range), UnitConverter::pixelsToMeters(-(position.y + range)) };
+    AABB.upperBound = { UnitConverter::pixelsToMeters(position.x + range), UnitConverter::pixelsToMeters(-(position.y - range)) };
+
+    this->world.QueryAABB(this, AABB);
+
+    cachedPerception.targets.clear();
+    cachedPerception.frame = this->currentFrame;
+    cachedPerception.range = range;
+    cachedPerception.targetType = targetType;
+
+    for (auto& candidate : this->candidates)
+    {
+        candidate.distance = Utility::distance(position, candidate.position);
+
+        if (candidate.distance <= range && this->isInLineOfSight(position, candidate.position))
+        {
+            cachedPerception.targets.push_back(candidate);
+        }
+    }
+
+    std::sort(std::begin(cachedPerception.targets), std::end(cachedPerception.targets),
+        [](const auto & target1, const auto & target2) { return target1.distance < target2.distance; });
+
+    return cachedPerception.targets;
+}
+
+bool Perception::isInLineOfSight(const sf::Vector2f& origin, const sf::Vector2f& destination)
+{
+    const b2Vec2 originPoint(UnitConverter::pixelsToMeters(origin.x), UnitConverter::pixelsToMeters(-origin.y));
+    const b2Vec2 destinationPoint(UnitConverter::pixelsToMeters(destination.x), UnitConverter::pixelsToMeters(-destination.y));
+
+    if ((destinationPoint - originPoint).LengthSquared() <= b2_epsilon)
+    {
+        return true;
+    }
+
+    this->occludedStatus = false;
+
+    this->world.RayCast(this, originPoint, destinationPoint);
+
+    return !this->occludedStatus;
+}
+
+void Perception::refreshTargets(PerceivedTargets& targets, const sf::Vector2f& position, float range)
+{
+    for (auto& target : targets)
+    {
+        if (target.entity.sync() && target.entity.has_component<PositionComponent>())
+        {
+            target.position = target.entity.get_component<PositionComponent>().getPosition();
+            target.distance = Utility::distance(position, target.position);
+        }
+        else
+        {
+            target.distance = -1.f;
+        }
+    }
+
+    targets.erase(std::remove_if(std::begin(targets), std::end(targets),
+        [range](const auto & target) { return target.distance < 0.f || target.distance > range; }), std::end(targets));
+
+    std::sort(std::begin(targets), std::end(targets),
+        [](const auto & target1, const auto & target2) { return target1.distance < target2.distance; });
+}
+
+bool Perception::ReportFixture(b2Fixture* fixture)
+{
+    const auto* collisionData = static_cast<CollisionData*>(fixture->GetUserData());
+    const auto* body = fixture->GetBody();
+
+    if (collisionData && collisionData->isEntity && (collisionData->objectType & this->queryType) &&
+        std::find(std::cbegin(this->candidateBodies), std::cend(this->candidateBodies), body) == std::cend(this->candidateBodies))
+    {
+        auto entity = collisionData->entity;
+
+        sf::Vector2f position(UnitConverter::metersToPixels(body->GetPosition().x), UnitConverter::metersToPixels(-body->GetPosition().y));
+
+        if (entity.sync() && entity.has_component<PositionComponent>())
+        {
+            position = entity.get_component<PositionComponent>().getPosition();
+        }
+
+        this->candidateBodies.push_back(body);
+        this->candidates.push_back({ entity, position, 0.f });
+    }
+
+    return true;
+}
+
+float32 Perception::ReportFixture(b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, float32 fraction)
+{
+    const auto* collisionData = static_cast<CollisionData*>(fixture->GetUserData());
+
+    if (!fixture->IsSensor() && collisionData && !collisionData->isEntity && (collisionData->objectType & ObjectType::Block))
+    {
+        this->occludedStatus = true;
+
+        return 0.f;
+    }
+
+    return -1.f;
+}
\ No newline at end of file
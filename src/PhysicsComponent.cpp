@@ -50,7 +50,6 @@ PhysicsComponent::PhysicsComponent(b2World& world, const b2Vec2& bodySize, b2Bod
         break;
     case ObjectType::Bullet:
         body->SetGravityScale(0.f);
-        body->SetBullet(true);
         break;
     case ObjectType::Liquid:
         fixtureDef.isSensor = true;
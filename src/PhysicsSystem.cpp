@@ -47,6 +47,20 @@ PhysicsSystem::PhysicsSystem(Entities& entities, Events& events, b2World& world,
 
 void PhysicsSystem::update(float deltaTime)
 {
+    this->entities.for_each<IntentComponent, PhysicsComponent>([this](auto entity, auto & intent, auto & physics)
+        {
+            if (intent.isMoving())
+            {
+                this->moveEntity(entity, physics, intent.getDirection());
+            }
+            if (intent.isJumping())
+            {
+                this->makeJump(entity, physics);
+
+                intent.setJumpStatus(false);
+            }
+        });
+
     this->entities.for_each<PhysicsComponent, PositionComponent>(
         [this](auto entity, auto & physics, auto & position)
         {
@@ -65,8 +79,14 @@ void PhysicsSystem::setEntitiesProperties(const EntityProperties& entitiesProper
 
 void PhysicsSystem::moveEntity(Entity entity, Direction direction)
 {
-    auto& physics = entity.get_component<PhysicsComponent>();
+    if (entity.has_component<PhysicsComponent>())
+    {
+        this->moveEntity(entity, entity.get_component<PhysicsComponent>(), direction);
+    }
+}
 
+void PhysicsSystem::moveEntity(Entity entity, PhysicsComponent& physics, Direction direction)
+{
     const auto& currentVelocity = physics.getVelocity();
 
     b2Vec2 newVelocity(0.f, 0.f);
@@ -77,12 +97,12 @@ void PhysicsSystem::moveEntity(Entity entity, Direction direction)
     case Direction::Right:
         newVelocity.x = b2Min(currentVelocity.x + physics.getAccelerationRate().x, physics.getMaxVelocity().x);
         deltaVelocity.x = newVelocity.x - currentVelocity.x;
-        this->events.broadcast(ChangeState{ entity, EntityState::Walking });
+        this->changeState(entity, EntityState::Walking);
         break;
     case Direction::Left:
         newVelocity.x = b2Max(currentVelocity.x - physics.getAccelerationRate().x, -physics.getMaxVelocity().x);
         deltaVelocity.x = newVelocity.x - currentVelocity.x;
-        this->events.broadcast(ChangeState{ entity, EntityState::Walking });
+        this->changeState(entity, EntityState::Walking);
         break;
     case Direction::Up:
         newVelocity.y = b2Min(currentVelocity.y + physics.getAccelerationRate().y, physics.getMaxVelocity().y);
@@ -117,18 +137,21 @@ void PhysicsSystem::makeJump(Entity entity)
 {
     if (entity.has_component<PhysicsComponent>())
     {
-        auto& physics = entity.get_component<PhysicsComponent>();
+        this->makeJump(entity, entity.get_component<PhysicsComponent>());
+    }
+}
 
-        if (!physics.isMidAir())
-        {
-            this->events.broadcast(ChangeState{ entity, EntityState::Jumping });
+void PhysicsSystem::makeJump(Entity entity, PhysicsComponent& physics)
+{
+    if (!physics.isMidAir())
+    {
+        this->changeState(entity, EntityState::Jumping);
 
-            physics.applyImpulse({ 0.f, physics.getJumpVelocity() * physics.getMass() });
+        physics.applyImpulse({ 0.f, physics.getJumpVelocity() * physics.getMass() });
 
-            if (entity.has_component<ControllableComponent>())
-            {
-                this->events.broadcast(PlaySound{ SoundBuffersID::Jump, false });
-            }
+        if (entity.has_component<ControllableComponent>())
+        {
+            this->events.broadcast(PlaySound{ SoundBuffersID::Jump, false });
         }
     }
 }
@@ -272,6 +295,14 @@ void PhysicsSystem::applyForce(Entity entity, const b2Vec2 & force)
     }
 }
 
+void PhysicsSystem::changeState(Entity entity, EntityState state)
+{
+    if (entity.has_component<StateComponent>() && entity.get_component<StateComponent>().getState() != state)
+    {
+        this->events.broadcast(ChangeState{ entity, state });
+    }
+}
+
 void PhysicsSystem::convertPositionCoordinates(const PhysicsComponent & physics, PositionComponent & position)
 {
     if (physics.getType() == b2BodyType::b2_dynamicBody || physics.getType() == b2BodyType::b2_kinematicBody)
@@ -284,7 +315,7 @@ void PhysicsSystem::checkPhysicalStatus(Entity entity, PhysicsComponent & physic
 {
     if (physics.getRelativeVelocity() == b2Vec2(0.f, 0.f))
     {
-        this->events.broadcast(ChangeState{ entity, EntityState::Idle });
+        this->changeState(entity, EntityState::Idle);
     }
 
     if (physics.isColliding(ObjectType::Feet, ObjectType::Block))
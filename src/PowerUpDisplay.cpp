@@ -8,6 +8,7 @@ InversePalindrome.com
 #include "PowerUpDisplay.hpp"
 #include "FilePaths.hpp"
 #include "AnimationParser.hpp"
+#include "RenderStatistics.hpp"
 
 #include <fstream>
 #include <sstream>
@@ -60,6 +61,14 @@ void PowerUpDisplay::clearPowerUps()
     this->powerUps.clear();
 }
 
+void PowerUpDisplay::batchAnimations(SpriteBatch& spriteBatch) const
+{
+    for (const auto& powerUpGraphic : this->powerUps)
+    {
+        spriteBatch.addSprite(powerUpGraphic.second.sprite, this->getTransform() * powerUpGraphic.second.getTransform());
+    }
+}
+
 void PowerUpDisplay::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
     states.transform = this->getTransform();
@@ -90,5 +99,5 @@ void PowerUpGraphics::draw(sf::RenderTarget& target, sf::RenderStates states) co
 {
     states.transform *= this->getTransform();
 
-    target.draw(this->sprite, states);
+    Statistics::renderStatistics.draw(target, this->sprite, states);
 }
\ No newline at end of file
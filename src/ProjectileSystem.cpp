@@ -0,0 +1,226 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - ProjectileSystem.cpp
+InversePalindrome.com
+*/
+
+
+#include "ProjectileSystem.hpp"
+#include "UnitConverter.hpp"
+#include "SimulationClock.hpp"
+
+#include <Box2D/Dynamics/b2Fixture.h>
+#include <Box2D/Collision/Shapes/b2PolygonShape.h>
+
+
+ProjectileSystem::ProjectileSystem(Entities& entities, Events& events, b2World& world, ComponentParser& componentParser, CollisionFilter& collisionFilter) :
+    System(entities, events),
+    world(world),
+    componentParser(componentParser),
+    collisionFilter(collisionFilter),
+    castingBullet(nullptr),
+    hitObject(nullptr)
+{
+}
+
+void ProjectileSystem::update(float deltaTime)
+{
+    for (std::size_t i = 0u; i < this->bullets.size(); )
+    {
+        if (this->advanceBullet(this->bullets[i], deltaTime))
+        {
+            ++i;
+        }
+        else
+        {
+            this->bullets[i] = this->bullets.back();
+            this->bullets.pop_back();
+        }
+    }
+
+    this->updateBatches();
+}
+
+bool ProjectileSystem::shootBullet(Entity shooter, const std::string& projectileID, const sf::Vector2f& position, Direction direction)
+{
+    const auto archetypeIndex = this->getArchetype(projectileID);
+
+    if (!archetypeIndex)
+    {
+        return false;
+    }
+
+    const auto& archetype = this->archetypes[archetypeIndex.value()];
+
+    Bullet bullet{ archetypeIndex.value(), shooter, {}, { UnitConverter::pixelsToMeters(position.x), UnitConverter::pixelsToMeters(-position.y) },
+        { 0.f, 0.f }, 0.f, 0.f };
+
+    switch (direction)
+    {
+    case Direction::Right:
+        bullet.velocity = { archetype.speed, 0.f };
+        break;
+    case Direction::Left:
+        bullet.velocity = { -archetype.speed, 0.f };
+        bullet.rotation = 180.f;
+        break;
+    case Direction::Up:
+        bullet.velocity = { 0.f, archetype.speed };
+        bullet.rotation = -90.f;
+        break;
+    case Direction::Down:
+        bullet.velocity = { 0.f, -archetype.speed };
+        bullet.rotation = 90.f;
+        break;
+    }
+
+    if (shooter.has_component<PositionComponent>())
+    {
+        bullet.shooterID = shooter.get_component<PositionComponent>().getEntityID();
+    }
+
+    this->bullets.push_back(bullet);
+
+    this->events.broadcast(PlaySound{ archetype.soundID, false });
+
+    return true;
+}
+
+void ProjectileSystem::clearBullets()
+{
+    this->bullets.clear();
+
+    this->updateBatches();
+}
+
+std::optional<std::size_t> ProjectileSystem::getArchetype(const std::string& projectileID)
+{
+    if (auto archetypeIndex = this->archetypeIndices.find(projectileID); archetypeIndex != std::end(this->archetypeIndices))
+    {
+        return archetypeIndex->second;
+    }
+
+    const auto& fields = this->componentParser.parseFields(projectileID + ".txt");
+
+    std::optional<std::size_t> archetypeIndex;
+
+    const auto bullet = fields.find("Bullet");
+    const auto physics = fields.find("Physics");
+
+    if (bullet != std::cend(fields) && physics != std::cend(fields))
+    {
+        if (auto sprite = this->componentParser.parseSprite(fields))
+        {
+            const auto& [damagePoints, soundID, force] = this->componentParser.parse<std::int32_t, std::size_t, float>(bullet->second);
+            const auto& [bodySizeX, bodySizeY, bodyType] = this->componentParser.parse<float, float, std::size_t>(physics->second);
+
+            auto mass = 0.f;
+
+            if (static_cast<b2BodyType>(bodyType) == b2_dynamicBody)
+            {
+                b2PolygonShape bodyShape;
+                bodyShape.SetAsBox(bodySizeX, bodySizeY);
+
+                b2MassData massData;
+                bodyShape.ComputeMass(&massData, 1.f);
+
+                mass = massData.mass;
+            }
+
+            const auto speed = mass > 0.f ? force * Simulation::timeStep / mass : 0.f;
+
+            this->archetypes.push_back({ damagePoints, SoundBuffersID{ soundID }, speed, sprite.value() });
+
+            archetypeIndex = this->archetypes.size() - 1u;
+        }
+    }
+
+    this->archetypeIndices.emplace(projectileID, archetypeIndex);
+
+    return archetypeIndex;
+}
+
+bool ProjectileSystem::advanceBullet(Bullet& bullet, float timeStep)
+{
+    const auto maxLifeTime = 5.f;
+
+    bullet.lifeTime += timeStep;
+
+    if (bullet.lifeTime > maxLifeTime)
+    {
+        return false;
+    }
+
+    const auto destination = bullet.position + timeStep * bullet.velocity;
+
+    if ((destination - bullet.position).LengthSquared() > b2_epsilon)
+    {
+        this->castingBullet = &bullet;
+        this->hitObject = nullptr;
+
+        this->world.RayCast(this, bullet.position, destination);
+
+        if (this->hitObject)
+        {
+            this->handleHit(bullet, *this->hitObject);
+
+            return false;
+        }
+    }
+
+    bullet.position = destination;
+
+    return true;
+}
+
+void ProjectileSystem::handleHit(const Bullet& bullet, CollisionData& object)
+{
+    if (object.isEntity && (object.objectType & ObjectType::Alive))
+    {
+        this->events.broadcast(CombatOcurred{ bullet.shooter, object.entity, this->archetypes[bullet.archetype].damagePoints });
+        this->events.broadcast(StopMovement{ object.entity });
+    }
+}
+
+void ProjectileSystem::updateBatches()
+{
+    this->spriteBatch.clear();
+
+    for (const auto& bullet : this->bullets)
+    {
+        sf::Transform transform;
+        transform.translate(UnitConverter::metersToPixels(bullet.position.x), UnitConverter::metersToPixels(-bullet.position.y)).rotate(bullet.rotation);
+
+        this->spriteBatch.addSprite(this->archetypes[bullet.archetype].sprite, transform);
+    }
+}
+
+void ProjectileSystem::capture(FrameSnapshot& snapshot) const
+{
+    snapshot.add(this->spriteBatch);
+}
+
+void ProjectileSystem::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    target.draw(this->spriteBatch, states);
+}
+
+float32 ProjectileSystem::ReportFixture(b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, float32 fraction)
+{
+    auto* object = static_cast<CollisionData*>(fixture->GetUserData());
+
+    if (fixture->IsSensor() || !object || !this->collisionFilter.shouldCollide(ObjectType::Bullet, object->objectType))
+    {
+        return -1.f;
+    }
+
+    if (object->isEntity && this->castingBullet->shooterID && object->entity.has_component<PositionComponent>() &&
+        object->entity.get_component<PositionComponent>().getEntityID() == this->castingBullet->shooterID.value())
+    {
+        return -1.f;
+    }
+
+    this->hitObject = object;
+
+    return fraction;
+}
\ No newline at end of file
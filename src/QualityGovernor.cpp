@@ -0,0 +1,121 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - QualityGovernor.cpp
+InversePalindrome.com
+*/
+
+
+#include "QualityGovernor.hpp"
+
+#include <iomanip>
+#include <algorithm>
+
+
+QualityGovernor::QualityGovernor(GraphicsProperties& graphicsProperties) :
+    graphicsProperties(graphicsProperties),
+    qualityLevels({ { 1.f, 1.f, 4096.f, 1.f }, { 1.f, 0.75f, 2048.f, 1.f }, { 0.85f, 0.5f, 1536.f, 0.75f },
+        { 0.75f, 0.35f, 1024.f, 0.5f }, { 0.6f, 0.25f, 768.f, 0.5f }, { 0.5f, 0.15f, 512.f, 0.35f } }),
+    frameBudget(graphicsProperties.framePacing == FramePacing::Capped && graphicsProperties.frameRateLimit > 0u ?
+        1000.f / graphicsProperties.frameRateLimit : 1000.f / 60.f),
+    qualityLevel(0u),
+    headroomWindows(0u),
+    frameCount(0u)
+{
+}
+
+void QualityGovernor::setLogFile(const std::string& fileName)
+{
+    this->logFile.close();
+    this->logFile.open(fileName);
+
+    this->logFile << std::fixed << std::setprecision(2);
+}
+
+void QualityGovernor::addFrameTime(float frameTime)
+{
+    const std::size_t windowSize = 90u;
+    const std::size_t recoveryWindows = 4u;
+
+    ++this->frameCount;
+
+    if (!this->graphicsProperties.adaptiveQuality)
+    {
+        this->frameTimes.clear();
+        this->headroomWindows = 0u;
+
+        return;
+    }
+
+    this->frameTimes.push_back(frameTime);
+
+    if (this->frameTimes.size() < windowSize)
+    {
+        return;
+    }
+
+    const auto medianFrameTime = this->getPercentile(0.5f);
+    const auto tailFrameTime = this->getPercentile(0.95f);
+    const auto previousLevel = this->qualityLevel;
+
+    this->frameTimes.clear();
+
+    if (tailFrameTime > this->frameBudget * 1.1f)
+    {
+        this->headroomWindows = 0u;
+        this->qualityLevel = std::min(this->qualityLevel + 1u, this->qualityLevels.size() - 1u);
+    }
+    else if (tailFrameTime < this->frameBudget * 0.7f)
+    {
+        if (++this->headroomWindows >= recoveryWindows && this->qualityLevel > 0u)
+        {
+            this->headroomWindows = 0u;
+            --this->qualityLevel;
+        }
+    }
+    else
+    {
+        this->headroomWindows = 0u;
+    }
+
+    this->applyQualityLevel();
+
+    if (this->qualityLevel != previousLevel)
+    {
+        this->logDecision(medianFrameTime, tailFrameTime, previousLevel);
+    }
+}
+
+std::size_t QualityGovernor::getQualityLevel() const
+{
+    return this->qualityLevel;
+}
+
+float QualityGovernor::getPercentile(float percentile)
+{
+    const auto rank = std::begin(this->frameTimes) + static_cast<std::ptrdiff_t>(percentile * (this->frameTimes.size() - 1u));
+
+    std::nth_element(std::begin(this->frameTimes), rank, std::end(this->frameTimes));
+
+    return *rank;
+}
+
+void QualityGovernor::applyQualityLevel()
+{
+    const auto& level = this->qualityLevels[this->qualityLevel];
+
+    this->graphicsProperties.renderScale = level.renderScale;
+    this->graphicsProperties.particleDensity = level.particleDensity;
+    this->graphicsProperties.animationLODDistance = level.animationLODDistance;
+    this->graphicsProperties.aiTickRate = level.aiTickRate;
+}
+
+void QualityGovernor::logDecision(float medianFrameTime, float tailFrameTime, std::size_t previousLevel)
+{
+    const auto& level = this->qualityLevels[this->qualityLevel];
+
+    this->logFile << "Frame " << this->frameCount << ": p50 " << medianFrameTime << " ms, p95 " << tailFrameTime << " ms, budget " << this->frameBudget
+        << " ms, quality " << previousLevel << " -> " << this->qualityLevel << " (render scale " << level.renderScale << ", particles "
+        << level.particleDensity << ", animation LOD " << level.animationLODDistance << ", AI rate " << level.aiTickRate << ")\n";
+
+    this->logFile.flush();
+}
\ No newline at end of file
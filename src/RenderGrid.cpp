@@ -0,0 +1,183 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - RenderGrid.cpp
+InversePalindrome.com
+*/
+
+
+#include "RenderGrid.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+
+RenderGrid::RenderGrid() :
+    cellSize(1024.f, 768.f),
+    entryCount(0u),
+    updateStamp(0u),
+    queryStamp(0u)
+{
+}
+
+void RenderGrid::setCellSize(const sf::Vector2f& cellSize)
+{
+    if (cellSize.x > 0.f && cellSize.y > 0.f && cellSize != this->cellSize)
+    {
+        this->cellSize = cellSize;
+        this->cells.clear();
+
+        for (auto& entry : this->entries)
+        {
+            entry.firstCell = { 1, 1 };
+            entry.lastCell = { 0, 0 };
+        }
+    }
+}
+
+void RenderGrid::beginUpdate()
+{
+    ++this->updateStamp;
+}
+
+std::size_t RenderGrid::update(std::optional<std::size_t> entryIndex, Entity entity, const sf::Vector2f& position, const sf::FloatRect& globalBounds)
+{
+    if (!entryIndex || entryIndex.value() >= this->entries.size() || !this->entries[entryIndex.value()].isActive)
+    {
+        if (this->freeEntries.empty())
+        {
+            entryIndex = this->entries.size();
+
+            this->entries.push_back({ entity, 0u, { 1, 1 }, { 0, 0 }, 0u, 0u, true });
+        }
+        else
+        {
+            entryIndex = this->freeEntries.back();
+
+            this->freeEntries.pop_back();
+            this->entries[entryIndex.value()] = { entity, 0u, { 1, 1 }, { 0, 0 }, 0u, 0u, true };
+        }
+
+        this->entries[entryIndex.value()].order = this->entryCount++;
+    }
+
+    auto& entry = this->entries[entryIndex.value()];
+
+    entry.entity = entity;
+    entry.updateStamp = this->updateStamp;
+
+    const auto firstCell = this->getCell({ position.x - globalBounds.width / 2.f, position.y - globalBounds.height / 2.f });
+    const auto lastCell = this->getCell({ position.x + globalBounds.width / 2.f, position.y + globalBounds.height / 2.f });
+
+    if (firstCell != entry.firstCell || lastCell != entry.lastCell)
+    {
+        this->removeCells(entryIndex.value());
+
+        entry.firstCell = firstCell;
+        entry.lastCell = lastCell;
+
+        this->insertCells(entryIndex.value());
+    }
+
+    return entryIndex.value();
+}
+
+void RenderGrid::endUpdate()
+{
+    for (std::size_t entryIndex = 0u; entryIndex < this->entries.size(); ++entryIndex)
+    {
+        auto& entry = this->entries[entryIndex];
+
+        if (entry.isActive && entry.updateStamp != this->updateStamp)
+        {
+            this->removeCells(entryIndex);
+
+            entry.isActive = false;
+
+            this->freeEntries.push_back(entryIndex);
+        }
+    }
+}
+
+void RenderGrid::query(const sf::FloatRect& area, std::vector<Entity>& entities) const
+{
+    entities.clear();
+    this->queriedEntries.clear();
+
+    ++this->queryStamp;
+
+    const auto firstCell = this->getCell({ area.left, area.top });
+    const auto lastCell = this->getCell({ area.left + area.width, area.top + area.height });
+
+    for (auto y = firstCell.y; y <= lastCell.y; ++y)
+    {
+        for (auto x = firstCell.x; x <= lastCell.x; ++x)
+        {
+            if (auto cell = this->cells.find(this->getCellKey({ x, y })); cell != std::end(this->cells))
+            {
+                for (auto entryIndex : cell->second)
+                {
+                    if (this->entries[entryIndex].queryStamp != this->queryStamp)
+                    {
+                        this->entries[entryIndex].queryStamp = this->queryStamp;
+                        this->queriedEntries.push_back(entryIndex);
+                    }
+                }
+            }
+        }
+    }
+
+    std::sort(std::begin(this->queriedEntries), std::end(this->queriedEntries), [this](auto entryIndex1, auto entryIndex2)
+        {
+            return this->entries[entryIndex1].order < this->entries[entryIndex2].order;
+        });
+
+    for (auto entryIndex : this->queriedEntries)
+    {
+        entities.push_back(this->entries[entryIndex].entity);
+    }
+}
+
+void RenderGrid::insertCells(std::size_t entryIndex)
+{
+    const auto& entry = this->entries[entryIndex];
+
+    for (auto y = entry.firstCell.y; y <= entry.lastCell.y; ++y)
+    {
+        for (auto x = entry.firstCell.x; x <= entry.lastCell.x; ++x)
+        {
+            this->cells[this->getCellKey({ x, y })].push_back(entryIndex);
+        }
+    }
+}
+
+void RenderGrid::removeCells(std::size_t entryIndex)
+{
+    const auto& entry = this->entries[entryIndex];
+
+    for (auto y = entry.firstCell.y; y <= entry.lastCell.y; ++y)
+    {
+        for (auto x = entry.firstCell.x; x <= entry.lastCell.x; ++x)
+        {
+            if (auto cell = this->cells.find(this->getCellKey({ x, y })); cell != std::end(this->cells))
+            {
+                auto& cellEntries = cell->second;
+
+                if (auto cellEntry = std::find(std::begin(cellEntries), std::end(cellEntries), entryIndex); cellEntry != std::end(cellEntries))
+                {
+                    *cellEntry = cellEntries.back();
+                    cellEntries.pop_back();
+                }
+            }
+        }
+    }
+}
+
+sf::Vector2i RenderGrid::getCell(const sf::Vector2f& position) const
+{
+    return { static_cast<int>(std::floor(position.x / this->cellSize.x)), static_cast<int>(std::floor(position.y / this->cellSize.y)) };
+}
+
+std::uint64_t RenderGrid::getCellKey(const sf::Vector2i& cell) const
+{
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cell.x)) << 32u) | static_cast<std::uint32_t>(cell.y);
+}
\ No newline at end of file
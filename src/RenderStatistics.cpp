@@ -0,0 +1,238 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - RenderStatistics.cpp
+InversePalindrome.com
+*/
+
+
+#include "RenderStatistics.hpp"
+
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+
+
+RenderStatistics Statistics::renderStatistics;
+
+RenderStatistics::RenderStatistics() :
+    enabled(false),
+    frame(0u),
+    lastTexture(nullptr),
+    lastShader(nullptr)
+{
+}
+
+void RenderStatistics::setEnabled(bool enabled)
+{
+    this->enabled = enabled;
+}
+
+bool RenderStatistics::isEnabled() const
+{
+    return this->enabled;
+}
+
+void RenderStatistics::setLogFile(const std::string& fileName)
+{
+    this->logFile.close();
+    this->logFile.open(fileName);
+
+    this->logFile << "Frame,Caller,DrawCalls,Vertices,TextureSwitches,ShaderSwitches,StateChanges,Milliseconds\n";
+}
+
+void RenderStatistics::beginFrame()
+{
+    if (!this->enabled)
+    {
+        return;
+    }
+
+    this->currentCounters.clear();
+    this->callerIndex.reset();
+
+    this->lastTexture = nullptr;
+    this->lastShader = nullptr;
+    this->lastBlendMode = sf::BlendAlpha;
+}
+
+void RenderStatistics::endFrame()
+{
+    if (!this->enabled || this->currentCounters.empty())
+    {
+        return;
+    }
+
+    this->clearCaller();
+
+    if (this->logFile.is_open())
+    {
+        for (const auto& [caller, counters] : this->currentCounters)
+        {
+            this->logFile << this->frame << ',' << caller << ',' << counters.drawCalls << ',' << counters.vertices << ','
+                << counters.textureSwitches << ',' << counters.shaderSwitches << ',' << counters.stateChanges << ',' << counters.milliseconds << '\n';
+        }
+    }
+
+    this->frameCounters.swap(this->currentCounters);
+
+    ++this->frame;
+}
+
+void RenderStatistics::setCaller(std::string_view caller)
+{
+    if (!this->enabled)
+    {
+        return;
+    }
+
+    this->clearCaller();
+
+    auto counters = std::find_if(std::begin(this->currentCounters), std::end(this->currentCounters),
+        [caller](const auto & callerCounters) { return callerCounters.first == caller; });
+
+    if (counters == std::end(this->currentCounters))
+    {
+        this->currentCounters.push_back({ caller, { 0u, 0u, 0u, 0u, 0u, 0.f } });
+
+        counters = std::end(this->currentCounters) - 1;
+    }
+
+    this->callerIndex = counters - std::begin(this->currentCounters);
+    this->callerStart = std::chrono::high_resolution_clock::now();
+}
+
+void RenderStatistics::clearCaller()
+{
+    if (!this->enabled || !this->callerIndex)
+    {
+        return;
+    }
+
+    this->closeCaller();
+
+    this->callerIndex.reset();
+}
+
+void RenderStatistics::recordDraw(const sf::RenderStates& states, std::size_t vertexCount)
+{
+    if (!this->enabled || !this->callerIndex)
+    {
+        return;
+    }
+
+    auto& counters = this->currentCounters[*this->callerIndex].second;
+
+    ++counters.drawCalls;
+    counters.vertices += vertexCount;
+
+    if (states.texture != this->lastTexture)
+    {
+        ++counters.textureSwitches;
+        this->lastTexture = states.texture;
+    }
+    if (states.shader != this->lastShader)
+    {
+        ++counters.shaderSwitches;
+        this->lastShader = states.shader;
+    }
+    if (states.blendMode != this->lastBlendMode)
+    {
+        ++counters.stateChanges;
+        this->lastBlendMode = states.blendMode;
+    }
+}
+
+void RenderStatistics::recordDraw(const sf::Sprite& sprite, sf::RenderStates states)
+{
+    states.texture = sprite.getTexture();
+
+    this->recordDraw(states, 4u);
+}
+
+void RenderStatistics::recordDraw(const sf::Text& text, sf::RenderStates states)
+{
+    if (!this->enabled || !this->callerIndex || !text.getFont())
+    {
+        return;
+    }
+
+    const auto vertexCount = this->getVertexCount(text);
+
+    if (vertexCount == 0u)
+    {
+        return;
+    }
+
+    states.texture = &text.getFont()->getTexture(text.getCharacterSize());
+
+    if (text.getOutlineThickness() != 0.f)
+    {
+        this->recordDraw(states, vertexCount);
+    }
+
+    this->recordDraw(states, vertexCount);
+}
+
+const std::vector<std::pair<std::string_view, DrawCounters>>& RenderStatistics::getFrameCounters() const
+{
+    return this->frameCounters;
+}
+
+std::string RenderStatistics::getSummary() const
+{
+    std::ostringstream summary;
+
+    DrawCounters total{ 0u, 0u, 0u, 0u, 0u, 0.f };
+
+    summary << std::fixed << std::setprecision(2) << "Caller  Draws  Vertices  Textures  Shaders  States  ms\n";
+
+    for (const auto& [caller, counters] : this->frameCounters)
+    {
+        summary << caller << "  " << counters.drawCalls << "  " << counters.vertices << "  " << counters.textureSwitches << "  "
+            << counters.shaderSwitches << "  " << counters.stateChanges << "  " << counters.milliseconds << '\n';
+
+        total.drawCalls += counters.drawCalls;
+        total.vertices += counters.vertices;
+        total.textureSwitches += counters.textureSwitches;
+        total.shaderSwitches += counters.shaderSwitches;
+        total.stateChanges += counters.stateChanges;
+        total.milliseconds += counters.milliseconds;
+    }
+
+    summary << "Total  " << total.drawCalls << "  " << total.vertices << "  " << total.textureSwitches << "  "
+        << total.shaderSwitches << "  " << total.stateChanges << "  " << total.milliseconds;
+
+    return summary.str();
+}
+
+void RenderStatistics::closeCaller()
+{
+    const std::chrono::duration<float, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - this->callerStart;
+
+    this->currentCounters[*this->callerIndex].second.milliseconds += elapsedTime.count();
+}
+
+std::size_t RenderStatistics::getVertexCount(const sf::Text& text) const
+{
+    const auto lineStyles = static_cast<std::size_t>((text.getStyle() & sf::Text::Underlined) != 0u) +
+        static_cast<std::size_t>((text.getStyle() & sf::Text::StrikeThrough) != 0u);
+
+    std::size_t vertexCount = 0u;
+    bool isLineEmpty = true;
+
+    for (const auto character : text.getString())
+    {
+        if (character == U'\n')
+        {
+            vertexCount += isLineEmpty ? 0u : lineStyles * 6u;
+            isLineEmpty = true;
+        }
+        else
+        {
+            vertexCount += character == U' ' || character == U'\t' ? 0u : 6u;
+            isLineEmpty = false;
+        }
+    }
+
+    return vertexCount + (isLineEmpty ? 0u : lineStyles * 6u);
+}
\ No newline at end of file
@@ -32,30 +32,93 @@ void RenderSystem::update(float deltaTime)
         {
             using Type = decltype(renderableComponent)::type;
 
-            this->entities.for_each<Type, PositionComponent>(
-                [](auto entity, auto & renderable, auto & position)
+            auto& renderGrid = this->renderGrids[brigand::index_of<Renderables, Type>::value];
+
+            renderGrid.setCellSize(this->viewSize / 2.f);
+            renderGrid.beginUpdate();
+
+            this->entities.for_each<Type>(
+                [&renderGrid](auto entity, auto & renderable)
                 {
-                    renderable.setPosition(position.getPosition() + renderable.getOffset());
+                    if (entity.has_component<PositionComponent>())
+                    {
+                        renderable.setPosition(entity.get_component<PositionComponent>().getPosition() + renderable.getOffset());
+                    }
+
+                    renderable.setGridEntry(renderGrid.update(renderable.getGridEntry(), entity, renderable.getPosition(), renderable.getGlobalBounds()));
                 });
+
+            renderGrid.endUpdate();
+        });
+}
+
+void RenderSystem::capture(FrameSnapshot& snapshot, const sf::View& view) const
+{
+    this->batchSprites(view);
+
+    snapshot.add(this->spriteBatch);
+
+    brigand::for_each<UnbatchedRenderables>([this, &snapshot, &view](auto renderableComponent)
+        {
+            using Type = decltype(renderableComponent)::type;
+
+            this->queryEntities<Type>(view, this->visibleEntities);
+
+            for (auto entity : this->visibleEntities)
+            {
+                const auto& renderable = entity.get_component<Type>();
+
+                if (Utility::isInsideView(view, renderable.getPosition(), renderable.getGlobalBounds()))
+                {
+                    renderable.capture(snapshot);
+                }
+            }
         });
 }
 
 void RenderSystem::draw(sf::RenderTarget & target, sf::RenderStates states) const
 {
-    brigand::for_each<Renderables>([this, &target, states](auto renderableComponent)
+    this->batchSprites(target.getView());
+
+    target.draw(this->spriteBatch, states);
+
+    brigand::for_each<UnbatchedRenderables>([this, &target, states](auto renderableComponent)
         {
             using Type = decltype(renderableComponent)::type;
 
-            this->entities.for_each<Type>([this, &target, states](auto entity, const auto & renderable) mutable
+            this->queryEntities<Type>(target.getView(), this->visibleEntities);
+
+            for (auto entity : this->visibleEntities)
+            {
+                const auto& renderable = entity.get_component<Type>();
+
+                if (Utility::isInsideView(target.getView(), renderable.getPosition(), renderable.getGlobalBounds()))
                 {
-                    if (Utility::isInsideView(target.getView(), renderable.getPosition(), renderable.getGlobalBounds()))
-                    {
-                        target.draw(renderable, states);
-                    }
-                });
+                    target.draw(renderable, states);
+                }
+            }
         });
 }
 
+void RenderSystem::batchSprites(const sf::View& view) const
+{
+    this->viewSize = view.getSize();
+
+    this->spriteBatch.clear();
+
+    this->queryEntities<SpriteComponent>(view, this->visibleEntities);
+
+    for (auto entity : this->visibleEntities)
+    {
+        const auto& sprite = entity.get_component<SpriteComponent>();
+
+        if (Utility::isInsideView(view, sprite.getPosition(), sprite.getGlobalBounds()))
+        {
+            this->spriteBatch.addSprite(sprite.getSprite(), sprite.getTransform());
+        }
+    }
+}
+
 void RenderSystem::setParentTransforms(Entity childEntity, Entity parentEntity, const sf::Vector2f & offset)
 {
     if (childEntity.has_component<ChildComponent>() && parentEntity.has_component<ParentComponent>()
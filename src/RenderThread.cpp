@@ -0,0 +1,156 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - RenderThread.cpp
+InversePalindrome.com
+*/
+
+
+#include "RenderThread.hpp"
+
+
+RenderThread::RenderThread(sf::RenderWindow& window) :
+    window(window),
+    writeIndex(0u),
+    running(false),
+    busy(false),
+    stopping(false)
+{
+}
+
+RenderThread::~RenderThread()
+{
+    this->stop();
+}
+
+void RenderThread::start()
+{
+    if (this->running)
+    {
+        return;
+    }
+
+    this->window.setActive(false);
+
+    this->stopping = false;
+    this->running = true;
+    this->thread = std::thread(&RenderThread::run, this);
+}
+
+void RenderThread::stop()
+{
+    if (!this->running)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        this->stopping = true;
+    }
+
+    this->condition.notify_all();
+    this->thread.join();
+
+    this->running = false;
+
+    this->window.setActive(true);
+}
+
+bool RenderThread::isRunning() const
+{
+    return this->running;
+}
+
+FrameSnapshot& RenderThread::getSnapshot()
+{
+    return this->snapshots[this->writeIndex];
+}
+
+void RenderThread::submit(std::function<void(const FrameSnapshot&)> present)
+{
+    const auto& snapshot = this->snapshots[this->writeIndex];
+
+    if (!this->running)
+    {
+        present(snapshot);
+
+        return;
+    }
+
+    this->post([present = std::move(present), &snapshot]() { present(snapshot); });
+
+    this->writeIndex = 1u - this->writeIndex;
+}
+
+void RenderThread::execute(std::function<void()> job)
+{
+    if (!this->running)
+    {
+        job();
+
+        return;
+    }
+
+    this->post(std::move(job));
+    this->wait();
+}
+
+void RenderThread::wait()
+{
+    if (!this->running || std::this_thread::get_id() == this->thread.get_id())
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(this->mutex);
+
+    this->condition.wait(lock, [this]() { return !this->pendingJob && !this->busy; });
+}
+
+void RenderThread::post(std::function<void()> job)
+{
+    std::unique_lock<std::mutex> lock(this->mutex);
+
+    this->condition.wait(lock, [this]() { return !this->pendingJob && !this->busy; });
+
+    this->pendingJob = std::move(job);
+
+    lock.unlock();
+
+    this->condition.notify_all();
+}
+
+void RenderThread::run()
+{
+    std::unique_lock<std::mutex> lock(this->mutex);
+
+    while (true)
+    {
+        this->condition.wait(lock, [this]() { return this->pendingJob || this->stopping; });
+
+        if (!this->pendingJob)
+        {
+            break;
+        }
+
+        auto job = std::move(this->pendingJob);
+
+        this->pendingJob = nullptr;
+        this->busy = true;
+
+        lock.unlock();
+
+        this->window.setActive(true);
+
+        job();
+
+        this->window.setActive(false);
+
+        lock.lock();
+
+        this->busy = false;
+
+        this->condition.notify_all();
+    }
+}
\ No newline at end of file
@@ -23,6 +23,11 @@ bool Renderable::isVisible() const
     return this->visibilityStatus;
 }
 
+std::optional<std::size_t> Renderable::getGridEntry() const
+{
+    return this->gridEntry;
+}
+
 void Renderable::setOffset(const sf::Vector2f& offset)
 {
     this->offset = offset;
@@ -31,4 +36,9 @@ void Renderable::setOffset(const sf::Vector2f& offset)
 void Renderable::setVisibilityStatus(bool visibilityStatus)
 {
     this->visibilityStatus = visibilityStatus;
+}
+
+void Renderable::setGridEntry(std::size_t gridEntry)
+{
+    this->gridEntry = gridEntry;
 }
\ No newline at end of file
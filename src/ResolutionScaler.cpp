@@ -0,0 +1,68 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - ResolutionScaler.cpp
+InversePalindrome.com
+*/
+
+
+#include "ResolutionScaler.hpp"
+#include "RenderStatistics.hpp"
+
+#include <algorithm>
+
+
+ResolutionScaler::ResolutionScaler() :
+    failedSize(0u, 0u)
+{
+}
+
+bool ResolutionScaler::render(const sf::View& view, float renderScale, const std::function<void(sf::RenderTarget&)>& drawScene)
+{
+    const sf::Vector2u size(std::max(1u, static_cast<unsigned>(view.getSize().x * renderScale)), std::max(1u, static_cast<unsigned>(view.getSize().y * renderScale)));
+
+    if (size == this->failedSize)
+    {
+        return false;
+    }
+
+    if (!this->renderTexture || this->renderTexture->getSize() != size)
+    {
+        auto renderTexture = std::make_unique<sf::RenderTexture>();
+
+        if (!renderTexture->create(size.x, size.y))
+        {
+            this->renderTexture.reset();
+            this->failedSize = size;
+
+            return false;
+        }
+
+        renderTexture->setSmooth(true);
+
+        this->renderTexture = std::move(renderTexture);
+        this->sprite.setTexture(this->renderTexture->getTexture(), true);
+    }
+
+    this->renderTexture->setView(view);
+    this->renderTexture->clear();
+
+    drawScene(*this->renderTexture);
+
+    this->renderTexture->display();
+
+    return true;
+}
+
+void ResolutionScaler::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    if (this->renderTexture)
+    {
+        const auto textureSize = sf::Vector2f(this->renderTexture->getSize());
+
+        states.transform.scale(target.getView().getSize().x / textureSize.x, target.getView().getSize().y / textureSize.y);
+
+        target.draw(this->sprite, states);
+
+        Statistics::renderStatistics.recordDraw(this->sprite, states);
+    }
+}
\ No newline at end of file
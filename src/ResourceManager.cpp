@@ -11,9 +11,11 @@ InversePalindrome.com
 #include <Thor/Resources/SfmlLoaders.hpp>
 
 #include <fstream>
+#include <utility>
 
 
-ResourceManager::ResourceManager(const std::string& resourcesFilePath)
+ResourceManager::ResourceManager(const std::string& resourcesFilePath, bool mediaEnabled) :
+    mediaEnabled(mediaEnabled)
 {
     resourceFactory.emplace("Textures", [this]
     (std::size_t ID, const std::string & resourceFilePath)
@@ -31,7 +33,12 @@ ResourceManager::ResourceManager(const std::string& resourcesFilePath)
     (std::size_t ID, const std::string & resourceFilePath)
         { sounds.acquire(SoundBuffersID{ ID }, thor::Resources::fromFile<sf::SoundBuffer>(resourceFilePath)); });
 
-    loadResources(resourcesFilePath);
+    atlas.setEnabled(mediaEnabled);
+
+    if (mediaEnabled)
+    {
+        loadResources(resourcesFilePath);
+    }
 }
 
 void ResourceManager::loadResources(const std::string& resourcesFilePath)
@@ -50,20 +57,55 @@ void ResourceManager::loadResources(const std::string& resourcesFilePath)
 
 sf::Texture& ResourceManager::getTexture(TexturesID textureID)
 {
+    if (!this->mediaEnabled)
+    {
+        return this->placeholderTexture;
+    }
+
     return this->textures[textureID];
 }
 
+std::optional<TextureRegion> ResourceManager::getTextureRegion(TexturesID textureID, const sf::IntRect& textureRect)
+{
+    if (!this->mediaEnabled)
+    {
+        return {};
+    }
+
+    return this->atlas.getRegion(this->textures[textureID], textureRect);
+}
+
+void ResourceManager::setAtlasFence(std::function<void()> atlasFence)
+{
+    this->atlas.setPackingFence(std::move(atlasFence));
+}
+
 sf::Image& ResourceManager::getImage(ImagesID imageID)
 {
+    if (!this->mediaEnabled)
+    {
+        return this->placeholderImage;
+    }
+
     return this->images[imageID];
 }
 
 sf::Font& ResourceManager::getFont(FontsID fontID)
 {
+    if (!this->mediaEnabled)
+    {
+        return this->placeholderFont;
+    }
+
     return this->fonts[fontID];
 }
 
 sf::SoundBuffer& ResourceManager::getSound(SoundBuffersID soundBuffersID)
 {
     return this->sounds[soundBuffersID];
+}
+
+bool ResourceManager::isMediaEnabled() const
+{
+    return this->mediaEnabled;
 }
\ No newline at end of file
@@ -11,6 +11,7 @@ InversePalindrome.com
 #include "FilePaths.hpp"
 #include "SpriteParser.hpp"
 #include "TextStyleParser.hpp"
+#include "RenderStatistics.hpp"
 
 #include <SFGUI/RadioButton.hpp>
 
@@ -29,7 +30,20 @@ SettingsState::SettingsState(StateMachine& stateMachine, StateData& stateData) :
     musicVolumeAdjustment(sfg::Adjustment::Create(stateData.soundManager.getMusicProperties().volume, 0.f, 105.f, 1.f, 10.f, 5.f)),
     soundScrollbar(sfg::Scrollbar::Create()),
     musicScrollbar(sfg::Scrollbar::Create()),
-    keyButtons(sfg::RadioButtonGroup::Create())
+    keyButtons(sfg::RadioButtonGroup::Create()),
+    adaptiveQualityButton(sfg::CheckButton::Create("Adaptive Quality")),
+    renderScaleLabel(sfg::Label::Create("Resolution")),
+    particleDensityLabel(sfg::Label::Create("Particles")),
+    animationLODLabel(sfg::Label::Create("Animation Range")),
+    aiTickRateLabel(sfg::Label::Create("AI Rate")),
+    renderScaleAdjustment(sfg::Adjustment::Create(stateData.graphicsProperties.renderScale * 100.f, 50.f, 105.f, 1.f, 10.f, 5.f)),
+    particleDensityAdjustment(sfg::Adjustment::Create(stateData.graphicsProperties.particleDensity * 100.f, 0.f, 105.f, 1.f, 10.f, 5.f)),
+    animationLODAdjustment(sfg::Adjustment::Create(stateData.graphicsProperties.animationLODDistance, 256.f, 4352.f, 64.f, 512.f, 256.f)),
+    aiTickRateAdjustment(sfg::Adjustment::Create(stateData.graphicsProperties.aiTickRate * 100.f, 25.f, 105.f, 1.f, 10.f, 5.f)),
+    renderScaleScrollbar(sfg::Scrollbar::Create()),
+    particleDensityScrollbar(sfg::Scrollbar::Create()),
+    animationLODScrollbar(sfg::Scrollbar::Create()),
+    aiTickRateScrollbar(sfg::Scrollbar::Create())
 {
     Parsers::parseSprite(stateData.resourceManager, "MediumPanel.txt", background);
     background.setOrigin(background.getGlobalBounds().width / 2.f, background.getGlobalBounds().height / 2.f);
@@ -88,19 +102,57 @@ SettingsState::SettingsState(StateMachine& stateMachine, StateData& stateData) :
     jumpButton->SetPosition({ 545.f, 1200.f });
     shootButton->SetPosition({ 1105.f, 1200.f });
 
-    Parsers::parseGUIProperties(stateData.guiManager, "SettingsGUI.txt");
-
-    stateData.guiManager.addWidget(backButton);
-    stateData.guiManager.addWidget(soundLabel);
-    stateData.guiManager.addWidget(musicLabel);
-    stateData.guiManager.addWidget(soundScrollbar);
-    stateData.guiManager.addWidget(musicScrollbar);
-    stateData.guiManager.addWidget(moveRightButton);
-    stateData.guiManager.addWidget(moveLeftButton);
-    stateData.guiManager.addWidget(moveUpButton);
-    stateData.guiManager.addWidget(moveDownButton);
-    stateData.guiManager.addWidget(jumpButton);
-    stateData.guiManager.addWidget(shootButton);
+    adaptiveQualityButton->SetPosition({ 545.f, 1290.f });
+    adaptiveQualityButton->SetActive(stateData.graphicsProperties.adaptiveQuality);
+    adaptiveQualityButton->GetSignal(sfg::ToggleButton::OnToggle).Connect([this] { toggleAdaptiveQuality(); });
+
+    renderScaleLabel->SetPosition({ 545.f, 1350.f });
+    particleDensityLabel->SetPosition({ 1105.f, 1350.f });
+    animationLODLabel->SetPosition({ 545.f, 1440.f });
+    aiTickRateLabel->SetPosition({ 1105.f, 1440.f });
+
+    renderScaleScrollbar->SetPosition({ 545.f, 1390.f });
+    particleDensityScrollbar->SetPosition({ 1105.f, 1390.f });
+    animationLODScrollbar->SetPosition({ 545.f, 1480.f });
+    aiTickRateScrollbar->SetPosition({ 1105.f, 1480.f });
+
+    renderScaleScrollbar->SetAdjustment(renderScaleAdjustment);
+    particleDensityScrollbar->SetAdjustment(particleDensityAdjustment);
+    animationLODScrollbar->SetAdjustment(animationLODAdjustment);
+    aiTickRateScrollbar->SetAdjustment(aiTickRateAdjustment);
+
+    for (auto& scrollbar : { renderScaleScrollbar, particleDensityScrollbar, animationLODScrollbar, aiTickRateScrollbar })
+    {
+        scrollbar->SetRequisition({ 400.f, 40.f });
+    }
+
+    for (auto& adjustment : { renderScaleAdjustment, particleDensityAdjustment, animationLODAdjustment, aiTickRateAdjustment })
+    {
+        adjustment->GetSignal(sfg::Adjustment::OnChange).Connect([this] { adjustQuality(); });
+    }
+
+    Parsers::parseGUIProperties(*stateData.guiManager, "SettingsGUI.txt");
+
+    stateData.guiManager->addWidget(backButton);
+    stateData.guiManager->addWidget(soundLabel);
+    stateData.guiManager->addWidget(musicLabel);
+    stateData.guiManager->addWidget(soundScrollbar);
+    stateData.guiManager->addWidget(musicScrollbar);
+    stateData.guiManager->addWidget(moveRightButton);
+    stateData.guiManager->addWidget(moveLeftButton);
+    stateData.guiManager->addWidget(moveUpButton);
+    stateData.guiManager->addWidget(moveDownButton);
+    stateData.guiManager->addWidget(jumpButton);
+    stateData.guiManager->addWidget(shootButton);
+    stateData.guiManager->addWidget(adaptiveQualityButton);
+    stateData.guiManager->addWidget(renderScaleLabel);
+    stateData.guiManager->addWidget(particleDensityLabel);
+    stateData.guiManager->addWidget(animationLODLabel);
+    stateData.guiManager->addWidget(aiTickRateLabel);
+    stateData.guiManager->addWidget(renderScaleScrollbar);
+    stateData.guiManager->addWidget(particleDensityScrollbar);
+    stateData.guiManager->addWidget(animationLODScrollbar);
+    stateData.guiManager->addWidget(aiTickRateScrollbar);
 }
 
 void SettingsState::handleEvent(const sf::Event & event)
@@ -119,9 +171,14 @@ void SettingsState::update(float deltaTime)
 
 void SettingsState::draw()
 {
-    this->stateData.window.draw(this->background);
-    this->stateData.window.draw(this->titleBar);
-    this->stateData.window.draw(this->title);
+    Statistics::renderStatistics.draw(this->stateData.window, this->background);
+    Statistics::renderStatistics.draw(this->stateData.window, this->titleBar);
+    Statistics::renderStatistics.draw(this->stateData.window, this->title);
+}
+
+bool SettingsState::isIdle() const
+{
+    return true;
 }
 
 bool SettingsState::isTransparent() const
@@ -144,6 +201,23 @@ void SettingsState::adjustMusicVolume()
     this->stateData.soundManager.setMusicVolume(this->musicVolumeScale->GetValue());
 }
 
+void SettingsState::adjustQuality()
+{
+    auto& graphicsProperties = this->stateData.graphicsProperties;
+
+    graphicsProperties.renderScale = this->renderScaleAdjustment->GetValue() / 100.f;
+    graphicsProperties.particleDensity = this->particleDensityAdjustment->GetValue() / 100.f;
+    graphicsProperties.animationLODDistance = this->animationLODAdjustment->GetValue();
+    graphicsProperties.aiTickRate = this->aiTickRateAdjustment->GetValue() / 100.f;
+
+    this->adaptiveQualityButton->SetActive(false);
+}
+
+void SettingsState::toggleAdaptiveQuality()
+{
+    this->stateData.graphicsProperties.adaptiveQuality = this->adaptiveQualityButton->IsActive();
+}
+
 void SettingsState::changeKeyBinding(sf::Keyboard::Key key)
 {
     for (const auto& keyButton : this->keyButtons->GetMembers())
@@ -165,6 +239,7 @@ void SettingsState::saveSettings()
     this->stateData.soundManager.getSoundProperties().saveData("SoundData.txt");
     this->stateData.soundManager.getMusicProperties().saveData("MusicData.txt");
     this->stateData.inputHandler.saveData();
+    this->stateData.graphicsProperties.saveData("GraphicsData.txt");
 }
 
 void SettingsState::transitionToState()
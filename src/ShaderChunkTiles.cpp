@@ -0,0 +1,99 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - ShaderChunkTiles.cpp
+InversePalindrome.com
+*/
+
+
+#include "ShaderChunkTiles.hpp"
+#include "RenderStatistics.hpp"
+
+#include <SFML/Graphics/Glsl.hpp>
+
+
+ShaderChunkTiles::ShaderChunkTiles(const sf::Texture& texture, sf::Shader& shader, const sf::Vector2f& tileSize, const sf::Vector2u& tileCount, const sf::Color& color) :
+    texture(texture),
+    shader(shader),
+    tileSize(tileSize)
+{
+    tileIndices.create(tileCount.x, tileCount.y, sf::Color::Transparent);
+
+    const sf::Vector2f size(tileCount.x * tileSize.x, tileCount.y * tileSize.y);
+    const sf::Vector2f tiles(static_cast<float>(tileCount.x), static_cast<float>(tileCount.y));
+
+    quad[0] = sf::Vertex({ 0.f, 0.f }, color, { 0.f, 0.f });
+    quad[1] = sf::Vertex({ size.x, 0.f }, color, { tiles.x, 0.f });
+    quad[2] = sf::Vertex(size, color, tiles);
+    quad[3] = sf::Vertex({ 0.f, size.y }, color, { 0.f, tiles.y });
+}
+
+void ShaderChunkTiles::setTile(const sf::Vector2u& position, const sf::Vector2u& tileIndex)
+{
+    this->tileIndices.setPixel(position.x, position.y, sf::Color(static_cast<sf::Uint8>(tileIndex.x), static_cast<sf::Uint8>(tileIndex.y), 0u, 255u));
+}
+
+void ShaderChunkTiles::upload()
+{
+    this->indexTexture.loadFromImage(this->tileIndices);
+
+    this->tileIndices = sf::Image();
+}
+
+bool ShaderChunkTiles::loadShader(sf::Shader& shader)
+{
+    const auto vertexShader = R"(#version 110
+
+        void main()
+        {
+            gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;
+            gl_TexCoord[0] = gl_MultiTexCoord0;
+            gl_FrontColor = gl_Color;
+        })";
+
+    const auto fragmentShader = R"(#version 110
+
+        uniform sampler2D tileIndices;
+        uniform sampler2D tileset;
+        uniform vec2 tileCount;
+        uniform vec2 tileSize;
+        uniform vec2 tilesetSize;
+
+        void main()
+        {
+            vec2 chunkPosition = gl_TexCoord[0].xy;
+            vec2 tile = floor(chunkPosition);
+            vec4 tileIndex = texture2D(tileIndices, (tile + 0.5) / tileCount);
+
+            if (tileIndex.a < 0.5)
+            {
+                discard;
+            }
+
+            vec2 tilesetPosition = (floor(tileIndex.rg * 255.0 + 0.5) + chunkPosition - tile) * tileSize;
+
+            gl_FragColor = gl_Color * texture2D(tileset, tilesetPosition / tilesetSize);
+        })";
+
+    return sf::Shader::isAvailable() && shader.loadFromMemory(vertexShader, fragmentShader);
+}
+
+bool ShaderChunkTiles::canIndex(const sf::Vector2u& tilesetTileCount)
+{
+    return tilesetTileCount.x <= 256u && tilesetTileCount.y <= 256u;
+}
+
+void ShaderChunkTiles::draw(sf::RenderTarget& renderTarget, sf::RenderStates states) const
+{
+    this->shader.setUniform("tileIndices", this->indexTexture);
+    this->shader.setUniform("tileset", this->texture);
+    this->shader.setUniform("tileCount", sf::Glsl::Vec2(this->indexTexture.getSize()));
+    this->shader.setUniform("tileSize", sf::Glsl::Vec2(this->tileSize));
+    this->shader.setUniform("tilesetSize", sf::Glsl::Vec2(this->texture.getSize()));
+
+    states.texture = nullptr;
+    states.shader = &this->shader;
+
+    renderTarget.draw(this->quad.data(), this->quad.size(), sf::Quads, states);
+
+    Statistics::renderStatistics.recordDraw(states, this->quad.size());
+}
\ No newline at end of file
@@ -12,6 +12,7 @@ InversePalindrome.com
 #include "FilePaths.hpp"
 #include "SpriteParser.hpp"
 #include "TextStyleParser.hpp"
+#include "RenderStatistics.hpp"
 
 #include <SFGUI/Label.hpp>
 #include <SFGUI/Image.hpp>
@@ -56,9 +57,9 @@ ShopState::ShopState(StateMachine& stateMachine, StateData& stateData) :
         coinDisplay.setNumberOfCoins(stateData.games.front().getItems()[Item::Coin]);
     }
 
-    Parsers::parseGUIProperties(stateData.guiManager, "ShopGUI.txt");
+    Parsers::parseGUIProperties(*stateData.guiManager, "ShopGUI.txt");
 
-    stateData.guiManager.addWidget(backButton);
+    stateData.guiManager->addWidget(backButton);
 
     loadShopData("ShopData.txt");
 }
@@ -76,9 +77,9 @@ void ShopState::update(float deltaTime)
 void ShopState::draw()
 {
     this->stateData.window.draw(this->coinDisplay);
-    this->stateData.window.draw(this->background);
-    this->stateData.window.draw(this->titleBar);
-    this->stateData.window.draw(this->title);
+    Statistics::renderStatistics.draw(this->stateData.window, this->background);
+    Statistics::renderStatistics.draw(this->stateData.window, this->titleBar);
+    Statistics::renderStatistics.draw(this->stateData.window, this->title);
 }
 
 bool ShopState::isTransparent() const
@@ -170,7 +171,7 @@ void ShopState::loadShopData(const std::string& fileName)
 
     notebook->SetPosition({ 250.f, 390.f });
 
-    this->stateData.guiManager.addWidget(notebook);
+    this->stateData.guiManager->addWidget(notebook);
 }
 
 void ShopState::loadButtonFunctions(Item item, ItemCategory itemCategory, bool hasBeenPurchased, std::size_t price, sfg::Button::Ptr itemButton)
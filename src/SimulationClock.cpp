@@ -0,0 +1,26 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - SimulationClock.cpp
+InversePalindrome.com
+*/
+
+
+#include "SimulationClock.hpp"
+
+
+SimulationClock Simulation::clock;
+
+SimulationClock::SimulationClock() :
+    elapsedTime(sf::Time::Zero)
+{
+}
+
+void SimulationClock::advance(sf::Time timeStep)
+{
+    this->elapsedTime += timeStep;
+}
+
+sf::Time SimulationClock::getElapsedTime() const
+{
+    return this->elapsedTime;
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - SimulationTimer.cpp
+InversePalindrome.com
+*/
+
+
+#include "SimulationTimer.hpp"
+#include "SimulationClock.hpp"
+
+#include <algorithm>
+
+
+SimulationTimer::SimulationTimer() :
+    timeLimit(sf::Time::Zero),
+    elapsedTime(sf::Time::Zero),
+    startTime(sf::Time::Zero),
+    running(false)
+{
+}
+
+sf::Time SimulationTimer::getRemainingTime() const
+{
+    return std::max(this->timeLimit - this->getElapsedTime(), sf::Time::Zero);
+}
+
+bool SimulationTimer::isRunning() const
+{
+    return this->running && !this->isExpired();
+}
+
+bool SimulationTimer::isExpired() const
+{
+    return this->getRemainingTime() == sf::Time::Zero;
+}
+
+void SimulationTimer::start()
+{
+    if (!this->running)
+    {
+        this->startTime = Simulation::clock.getElapsedTime();
+        this->running = true;
+    }
+}
+
+void SimulationTimer::stop()
+{
+    if (this->running)
+    {
+        this->elapsedTime = this->getElapsedTime();
+        this->running = false;
+    }
+}
+
+void SimulationTimer::reset(sf::Time timeLimit)
+{
+    this->timeLimit = timeLimit;
+    this->elapsedTime = sf::Time::Zero;
+    this->running = false;
+}
+
+void SimulationTimer::restart(sf::Time timeLimit)
+{
+    this->reset(timeLimit);
+    this->start();
+}
+
+sf::Time SimulationTimer::getElapsedTime() const
+{
+    if (this->running)
+    {
+        return this->elapsedTime + Simulation::clock.getElapsedTime() - this->startTime;
+    }
+
+    return this->elapsedTime;
+}
\ No newline at end of file
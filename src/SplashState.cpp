@@ -7,6 +7,7 @@ InversePalindrome.com
 
 #include "SplashState.hpp"
 #include "StateMachine.hpp"
+#include "RenderStatistics.hpp"
 
 
 SplashState::SplashState(StateMachine& stateMachine, StateData& stateData) :
@@ -35,5 +36,5 @@ void SplashState::update(float deltaTime)
 
 void SplashState::draw()
 {
-    this->stateData.window.draw(splashScreen);
+    Statistics::renderStatistics.draw(this->stateData.window, this->splashScreen);
 }
\ No newline at end of file
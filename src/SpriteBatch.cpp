@@ -0,0 +1,95 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - SpriteBatch.cpp
+InversePalindrome.com
+*/
+
+
+#include "SpriteBatch.hpp"
+#include "RenderStatistics.hpp"
+
+#include <cmath>
+
+
+SpriteBatch::SpriteBatch() :
+    batchCount(0u)
+{
+}
+
+void SpriteBatch::clear()
+{
+    this->batchCount = 0u;
+}
+
+void SpriteBatch::addSprite(const sf::Sprite& sprite, const sf::Transform& transform)
+{
+    const auto* texture = sprite.getTexture();
+
+    if (!texture)
+    {
+        return;
+    }
+
+    auto& vertices = this->getVertices(*texture);
+
+    const auto combinedTransform = transform * sprite.getTransform();
+    const auto& textureRect = sprite.getTextureRect();
+    const auto& color = sprite.getColor();
+
+    const auto width = static_cast<float>(std::abs(textureRect.width));
+    const auto height = static_cast<float>(std::abs(textureRect.height));
+
+    const auto left = static_cast<float>(textureRect.left);
+    const auto right = left + textureRect.width;
+    const auto top = static_cast<float>(textureRect.top);
+    const auto bottom = top + textureRect.height;
+
+    vertices.append({ combinedTransform.transformPoint(0.f, 0.f), color, { left, top } });
+    vertices.append({ combinedTransform.transformPoint(width, 0.f), color, { right, top } });
+    vertices.append({ combinedTransform.transformPoint(width, height), color, { right, bottom } });
+    vertices.append({ combinedTransform.transformPoint(0.f, height), color, { left, bottom } });
+}
+
+void SpriteBatch::addQuad(const sf::Texture& texture, const std::array<sf::Vertex, 4u>& quad)
+{
+    auto& vertices = this->getVertices(texture);
+
+    for (const auto& vertex : quad)
+    {
+        vertices.append(vertex);
+    }
+}
+
+sf::VertexArray& SpriteBatch::getVertices(const sf::Texture& texture)
+{
+    if (this->batchCount > 0u && this->batches[this->batchCount - 1u].first == &texture)
+    {
+        return this->batches[this->batchCount - 1u].second;
+    }
+
+    if (this->batchCount == this->batches.size())
+    {
+        this->batches.push_back({ &texture, sf::VertexArray(sf::Quads) });
+    }
+
+    auto& batch = this->batches[this->batchCount++];
+
+    batch.first = &texture;
+    batch.second.clear();
+
+    return batch.second;
+}
+
+void SpriteBatch::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    for (std::size_t batchIndex = 0u; batchIndex < this->batchCount; ++batchIndex)
+    {
+        const auto& [texture, vertices] = this->batches[batchIndex];
+
+        states.texture = texture;
+
+        target.draw(vertices, states);
+
+        Statistics::renderStatistics.recordDraw(states, vertices.getVertexCount());
+    }
+}
\ No newline at end of file
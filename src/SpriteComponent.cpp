@@ -8,6 +8,8 @@ InversePalindrome.com
 #include "SpriteComponent.hpp"
 #include "SpriteParser.hpp"
 
+#include <algorithm>
+
 
 SpriteComponent::SpriteComponent(ResourceManager& resourceManager, TexturesID textureID, const sf::Vector2f& scale) :
     Component("SpriteB"),
@@ -15,6 +17,8 @@ SpriteComponent::SpriteComponent(ResourceManager& resourceManager, TexturesID te
     sprite(resourceManager.getTexture(textureID)),
     resourceManager(&resourceManager)
 {
+    setTextureRect(sprite.getTextureRect());
+
     sprite.setOrigin(sprite.getLocalBounds().width / 2.f, sprite.getLocalBounds().height / 2.f);
     sprite.setScale(scale);
 }
@@ -22,9 +26,10 @@ SpriteComponent::SpriteComponent(ResourceManager& resourceManager, TexturesID te
 SpriteComponent::SpriteComponent(ResourceManager & resourceManager, TexturesID textureID, const sf::IntRect & textureRect, const sf::Vector2f & scale) :
     Component("SpriteB"),
     textureID(textureID),
-    sprite(resourceManager.getTexture(textureID), textureRect),
     resourceManager(&resourceManager)
 {
+    setTextureRect(textureRect);
+
     sprite.setOrigin(sprite.getLocalBounds().width / 2.f, sprite.getLocalBounds().height / 2.f);
     sprite.setScale(scale);
 }
@@ -34,7 +39,9 @@ SpriteComponent::SpriteComponent(ResourceManager & resourceManager, const std::s
     resourceManager(&resourceManager),
     fileName(fileName)
 {
-    Parsers::parseSprite(resourceManager, fileName, sprite);
+    textureID = Parsers::parseSprite(resourceManager, fileName, sprite);
+
+    setTextureRect(sprite.getTextureRect());
 
     sprite.setOrigin(sprite.getLocalBounds().width / 2.f, sprite.getLocalBounds().height / 2.f);
 }
@@ -45,8 +52,8 @@ std::ostream& operator<<(std::ostream & os, const SpriteComponent & component)
 
     if (component.getName() == "SpriteB")
     {
-        os << static_cast<std::size_t>(component.getTextureID()) << ' ' << component.sprite.getTextureRect().left << ' ' << component.sprite.getTextureRect().top
-            << ' ' << component.sprite.getTextureRect().width << ' ' << component.sprite.getTextureRect().height << ' ' << component.sprite.getScale().x << ' ' <<
+        os << static_cast<std::size_t>(component.getTextureID()) << ' ' << component.textureRect.left << ' ' << component.textureRect.top
+            << ' ' << component.textureRect.width << ' ' << component.textureRect.height << ' ' << component.sprite.getScale().x << ' ' <<
             component.sprite.getScale().y;
     }
     else if (component.getName() == "SpriteC")
@@ -72,9 +79,58 @@ sf::Sprite& SpriteComponent::getSprite()
     return this->sprite;
 }
 
+const sf::Sprite& SpriteComponent::getSprite() const
+{
+    return this->sprite;
+}
+
+const sf::IntRect& SpriteComponent::getTextureRect() const
+{
+    return this->textureRect;
+}
+
 void SpriteComponent::setSprite(const std::string & fileName)
 {
-    Parsers::parseSprite(*resourceManager, fileName, this->sprite);
+    this->textureID = Parsers::parseSprite(*resourceManager, fileName, this->sprite);
+    this->frameRegions.clear();
+
+    this->setTextureRect(this->sprite.getTextureRect());
+}
+
+void SpriteComponent::setTextureRect(const sf::IntRect& textureRect)
+{
+    this->textureRect = textureRect;
+
+    if (const auto& region = this->getTextureRegion(textureRect))
+    {
+        this->sprite.setTexture(*region->texture);
+        this->sprite.setTextureRect(region->textureRect);
+    }
+    else
+    {
+        this->sprite.setTexture(this->resourceManager->getTexture(this->textureID));
+        this->sprite.setTextureRect(textureRect);
+    }
+}
+
+void SpriteComponent::packTextureRect(const sf::IntRect& textureRect)
+{
+    this->getTextureRegion(textureRect);
+}
+
+const std::optional<TextureRegion>& SpriteComponent::getTextureRegion(const sf::IntRect& textureRect)
+{
+    auto frameRegion = std::find_if(std::begin(this->frameRegions), std::end(this->frameRegions),
+        [&textureRect](const auto & frameRegion) { return frameRegion.first == textureRect; });
+
+    if (frameRegion == std::end(this->frameRegions))
+    {
+        this->frameRegions.emplace_back(textureRect, this->resourceManager->getTextureRegion(this->textureID, textureRect));
+
+        return this->frameRegions.back().second;
+    }
+
+    return frameRegion->second;
 }
 
 void SpriteComponent::draw(sf::RenderTarget & target, sf::RenderStates states) const
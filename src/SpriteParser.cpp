@@ -12,11 +12,13 @@ InversePalindrome.com
 #include <sstream>
 
 
-void Parsers::parseSprite(ResourceManager& resourceManager, const std::string& fileName, sf::Sprite& sprite)
+TexturesID Parsers::parseSprite(ResourceManager& resourceManager, const std::string& fileName, sf::Sprite& sprite)
 {
     std::ifstream inFile(Path::spriteInfo / fileName);
     std::string line;
 
+    TexturesID spriteTextureID{ 0u };
+
     while (std::getline(inFile, line))
     {
         std::istringstream iStream(line);
@@ -31,7 +33,9 @@ void Parsers::parseSprite(ResourceManager& resourceManager, const std::string& f
 
             iStream >> textureID;
 
-            sprite.setTexture(resourceManager.getTexture(TexturesID{ textureID }));
+            spriteTextureID = TexturesID{ textureID };
+
+            sprite.setTexture(resourceManager.getTexture(spriteTextureID), true);
         }
         else if (category == "SubRect")
         {
@@ -58,4 +62,6 @@ void Parsers::parseSprite(ResourceManager& resourceManager, const std::string& f
             sprite.setRotation(angle);
         }
     }
+
+    return spriteTextureID;
 }
\ No newline at end of file
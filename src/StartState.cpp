@@ -10,6 +10,7 @@ InversePalindrome.com
 #include "EffectParser.hpp"
 #include "TextStyleParser.hpp"
 #include "FilePaths.hpp"
+#include "RenderStatistics.hpp"
 
 #include <Thor/Math/Distributions.hpp>
 
@@ -17,7 +18,9 @@ InversePalindrome.com
 StartState::StartState(StateMachine& stateMachine, StateData& stateData) :
     State(stateMachine, stateData),
     view(stateData.window.getDefaultView()),
-    emitter(Parsers::parseEmitter("StartEmitters.txt"))
+    particleEngine(stateData.resourceManager),
+    emitter(Parsers::parseEmitter("StartEmitters.txt")),
+    particlePool(particleEngine.getPool("StartParticles.txt"))
 {
     auto& backgroundTexture = stateData.resourceManager.getTexture(TexturesID::StartBackground);
 
@@ -25,9 +28,6 @@ StartState::StartState(StateMachine& stateMachine, StateData& stateData) :
 
     background.setTexture(backgroundTexture);
 
-    Parsers::parseParticleSystem(stateData.resourceManager, "StartParticles.txt", particleSystem);
-    particleSystem.addEmitter(thor::refEmitter(emitter));
-
     Parsers::parseStyle(stateData.resourceManager, "TitleStyle.txt", titleLabel);
     titleLabel.setString("Nihil");
     titleLabel.setOrigin(titleLabel.getLocalBounds().width / 2.f, titleLabel.getLocalBounds().height / 2.f);
@@ -51,9 +51,7 @@ void StartState::handleEvent(const sf::Event & event)
 
 void StartState::update(float deltaTime)
 {
-    this->stateData.guiManager.update(deltaTime);
-
-    this->particleSystem.update(sf::seconds(deltaTime));
+    this->stateData.guiManager->update(deltaTime);
 
     this->view.move(this->viewSpeed * deltaTime, 0.f);
 
@@ -64,19 +62,22 @@ void StartState::update(float deltaTime)
 
     this->emitter.setParticlePosition(thor::Distributions::rect({ this->view.getCenter().x - this->view.getSize().x / 2.f - 200.f,
         0.f }, { this->view.getSize().x, this->view.getSize().y - 200.f }));
+
+    this->particleEngine.emit(this->particlePool, this->emitter, { 0.f, 0.f }, deltaTime);
+    this->particleEngine.update(deltaTime);
 }
 
 void StartState::draw()
 {
     this->stateData.window.setView(this->view);
 
-    this->stateData.window.draw(this->background);
-    this->stateData.window.draw(this->particleSystem);
+    Statistics::renderStatistics.draw(this->stateData.window, this->background);
+    this->stateData.window.draw(this->particleEngine);
 
     this->stateData.window.setView(this->stateData.window.getDefaultView());
 
-    this->stateData.window.draw(this->titleLabel);
-    this->stateData.window.draw(this->continueLabel);
+    Statistics::renderStatistics.draw(this->stateData.window, this->titleLabel);
+    Statistics::renderStatistics.draw(this->stateData.window, this->continueLabel);
 }
 
 void StartState::transitionToMenu()
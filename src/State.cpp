@@ -15,6 +15,11 @@ State::State(StateMachine& stateMachine, StateData& stateData) :
 {
 }
 
+bool State::capture(FrameSnapshot& snapshot)
+{
+    return false;
+}
+
 void State::showWidgets(bool showStatus)
 {
 }
@@ -25,6 +30,11 @@ bool State::isTransparent() const
 }
 
 bool State::isDependent() const
+{
+    return false;
+}
+
+bool State::isIdle() const
 {
     return false;
 }
\ No newline at end of file
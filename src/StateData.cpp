@@ -9,12 +9,17 @@ InversePalindrome.com
 
 
 StateData::StateData(std::vector<Game>& games, ResourceManager& resourceManager, SoundManager& soundManager,
-    GUIManager& guiManager, InputHandler& inputHandler, sf::RenderWindow& window) :
+    GUIManager* guiManager, InputHandler& inputHandler, GraphicsProperties& graphicsProperties,
+    sf::RenderWindow& window, RenderThread& renderThread) :
     games(games),
     resourceManager(resourceManager),
     soundManager(soundManager),
     guiManager(guiManager),
     inputHandler(inputHandler),
-    window(window)
+    graphicsProperties(graphicsProperties),
+    window(window),
+    renderThread(renderThread),
+    defaultView(window.getDefaultView()),
+    isHeadless(false)
 {
 }
\ No newline at end of file
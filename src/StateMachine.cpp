@@ -12,7 +12,8 @@ StateMachine::StateMachine(StateData& stateData) :
     stateData(stateData),
     states(),
     stateActions(),
-    stateFactory()
+    stateFactory(),
+    statesChanged(false)
 {
 }
 
@@ -30,26 +31,9 @@ void StateMachine::update(float deltaTime)
 {
     if (!this->states.empty())
     {
-        if (this->states.back().second->isDependent() && this->states.size() > 1)
+        for (auto statePosition = this->getFirstUpdatedState(); statePosition < this->states.size(); ++statePosition)
         {
-            auto itr = std::end(this->states);
-
-            for (; itr != std::begin(this->states); --itr)
-            {
-                if (itr != std::end(this->states) && !(*itr).second->isDependent())
-                {
-                    break;
-                }
-            }
-
-            for (; itr != std::end(this->states); ++itr)
-            {
-                (*itr).second->update(deltaTime);
-            }
-        }
-        else
-        {
-            this->states.back().second->update(deltaTime);
+            this->states[statePosition].second->update(deltaTime);
         }
     }
 
@@ -58,30 +42,55 @@ void StateMachine::update(float deltaTime)
 
 void StateMachine::draw()
 {
+    this->statesChanged = false;
+
     if (!this->states.empty())
     {
-        if (this->states.back().second->isTransparent() && this->states.size() > 1)
+        for (auto statePosition = this->getFirstDrawnState(); statePosition < this->states.size(); ++statePosition)
+        {
+            this->states[statePosition].second->draw();
+        }
+    }
+}
+
+bool StateMachine::capture(FrameSnapshot& snapshot)
+{
+    this->statesChanged = false;
+
+    if (this->states.empty())
+    {
+        return false;
+    }
+
+    for (auto statePosition = this->getFirstDrawnState(); statePosition < this->states.size(); ++statePosition)
+    {
+        if (!this->states[statePosition].second->capture(snapshot))
         {
-            auto itr = std::end(this->states);
-
-            for (; itr != std::begin(this->states); --itr)
-            {
-                if (itr != std::end(this->states) && !(*itr).second->isTransparent())
-                {
-                    break;
-                }
-            }
-
-            for (; itr != std::end(this->states); ++itr)
-            {
-                (*itr).second->draw();
-            }
+            snapshot.clear();
+
+            return false;
         }
-        else
+    }
+
+    return true;
+}
+
+bool StateMachine::isIdle() const
+{
+    if (this->states.empty() || this->statesChanged)
+    {
+        return false;
+    }
+
+    for (auto statePosition = this->getFirstUpdatedState(); statePosition < this->states.size(); ++statePosition)
+    {
+        if (!this->states[statePosition].second->isIdle())
         {
-            this->states.back().second->draw();
+            return false;
         }
     }
+
+    return true;
 }
 
 StateMachine::StatePtr& StateMachine::operator[](std::size_t statePosition)
@@ -102,32 +111,71 @@ void StateMachine::changeState(StateID stateID)
 
 void StateMachine::pushState(StateID stateID)
 {
-    this->stateData.guiManager.hideAllWidgets();
+    this->hideWidgets();
 
     this->stateActions.push_back([this, stateID] { this->states.push_back({ stateID, this->getState(stateID) }); });
 }
 
 void StateMachine::popState()
 {
-    this->stateData.guiManager.hideAllWidgets();
+    this->hideWidgets();
 
     this->stateActions.push_back([this] { this->states.pop_back(); });
 }
 
 void StateMachine::clearStates()
 {
-    this->stateData.guiManager.hideAllWidgets();
+    this->hideWidgets();
 
     this->stateActions.push_back([this] { this->states.clear(); });
 }
 
+void StateMachine::hideWidgets()
+{
+    if (this->stateData.guiManager)
+    {
+        this->stateData.guiManager->hideAllWidgets();
+    }
+}
+
 StateMachine::StatePtr StateMachine::getState(StateID stateID)
 {
     return this->stateFactory.find(stateID)->second();
 }
 
+std::size_t StateMachine::getFirstUpdatedState() const
+{
+    auto statePosition = this->states.size() - 1u;
+
+    while (statePosition > 0u && this->states[statePosition].second->isDependent())
+    {
+        --statePosition;
+    }
+
+    return statePosition;
+}
+
+std::size_t StateMachine::getFirstDrawnState() const
+{
+    auto statePosition = this->states.size() - 1u;
+
+    while (statePosition > 0u && this->states[statePosition].second->isTransparent())
+    {
+        --statePosition;
+    }
+
+    return statePosition;
+}
+
 void StateMachine::processStateActions()
 {
+    if (!this->stateActions.empty())
+    {
+        this->stateData.renderThread.wait();
+
+        this->statesChanged = true;
+    }
+
     for (const auto& action : this->stateActions)
     {
         action();
@@ -6,7 +6,9 @@ InversePalindrome.com
 
 
 #include "TextComponent.hpp"
+#include "GlyphCache.hpp"
 #include "TextStyleParser.hpp"
+#include "RenderStatistics.hpp"
 
 
 TextComponent::TextComponent(ResourceManager& resourceManager, const std::string& inputText, const std::string& fileName) :
@@ -28,6 +30,8 @@ std::ostream& operator<<(std::ostream & os, const TextComponent & component)
 
 sf::FloatRect TextComponent::getGlobalBounds() const
 {
+    Rendering::glyphCache.prepare(this->text);
+
     return this->text.getGlobalBounds();
 }
 
@@ -36,9 +40,18 @@ void TextComponent::setText(const std::string & text)
     this->text.setString(text);
 }
 
+void TextComponent::capture(FrameSnapshot& snapshot, sf::RenderStates states) const
+{
+    states.transform *= this->getTransform();
+
+    snapshot.add(this->text, states);
+}
+
 void TextComponent::draw(sf::RenderTarget & target, sf::RenderStates states) const
 {
     states.transform *= this->getTransform();
 
     target.draw(this->text, states);
+
+    Statistics::renderStatistics.recordDraw(this->text, states);
 }
\ No newline at end of file
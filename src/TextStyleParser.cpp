@@ -7,6 +7,7 @@ InversePalindrome.com
 
 #include "TextStyleParser.hpp"
 #include "FilePaths.hpp"
+#include "GlyphCache.hpp"
 
 #include <fstream>
 #include <sstream>
@@ -25,7 +26,7 @@ void Parsers::parseStyle(ResourceManager& resourceManager, const std::string& fi
 
         iStream >> category;
 
-        if (category == "Font")
+        if (category == "Font" && resourceManager.isMediaEnabled())
         {
             std::size_t fontID = 0u;
 
@@ -66,4 +67,6 @@ void Parsers::parseStyle(ResourceManager& resourceManager, const std::string& fi
             text.setOutlineColor(sf::Color(static_cast<sf::Uint8>(R), static_cast<sf::Uint8>(G), static_cast<sf::Uint8>(B)));
         }
     }
+
+    Rendering::glyphCache.prepare(text);
 }
\ No newline at end of file
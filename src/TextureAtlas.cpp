@@ -0,0 +1,204 @@
+/*
+Copyright (c) 2017 InversePalindrome
+Nihil - TextureAtlas.cpp
+InversePalindrome.com
+*/
+
+
+#include "TextureAtlas.hpp"
+
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+
+#include <utility>
+#include <algorithm>
+
+
+TextureAtlas::TextureAtlas() :
+    pageSize(0u),
+    enabled(true)
+{
+}
+
+std::optional<TextureRegion> TextureAtlas::getRegion(const sf::Texture& texture, const sf::IntRect& textureRect)
+{
+    if (!this->enabled || textureRect.width <= 0 || textureRect.height <= 0)
+    {
+        return {};
+    }
+
+    if (auto region = this->findRegion(texture, textureRect))
+    {
+        return region;
+    }
+
+    if (this->isRejected(texture, textureRect))
+    {
+        return {};
+    }
+
+    const auto textureSize = sf::Vector2i(texture.getSize());
+
+    if (textureRect.left < 0 || textureRect.top < 0 || textureRect.left + textureRect.width > textureSize.x ||
+        textureRect.top + textureRect.height > textureSize.y)
+    {
+        this->rejectedRegions[&texture].push_back(textureRect);
+
+        return {};
+    }
+
+    if (!this->pageSize)
+    {
+        this->pageSize = std::min(2048u, sf::Texture::getMaximumSize());
+    }
+
+    const auto maxTextureSize = static_cast<int>(this->pageSize / 4u);
+    const auto maxRegionSize = static_cast<int>(this->pageSize / 2u);
+
+    if (textureSize.x <= maxTextureSize && textureSize.y <= maxTextureSize)
+    {
+        this->packRegion(texture, { 0, 0, textureSize.x, textureSize.y });
+    }
+    else if (textureRect.width <= maxRegionSize && textureRect.height <= maxRegionSize)
+    {
+        this->packRegion(texture, textureRect);
+    }
+
+    auto region = this->findRegion(texture, textureRect);
+
+    if (!region)
+    {
+        this->rejectedRegions[&texture].push_back(textureRect);
+    }
+
+    return region;
+}
+
+std::size_t TextureAtlas::getPageCount() const
+{
+    return this->pages.size();
+}
+
+void TextureAtlas::setPackingFence(std::function<void()> packingFence)
+{
+    this->packingFence = std::move(packingFence);
+}
+
+void TextureAtlas::setEnabled(bool enabled)
+{
+    this->enabled = enabled;
+}
+
+std::optional<TextureRegion> TextureAtlas::findRegion(const sf::Texture& texture, const sf::IntRect& textureRect) const
+{
+    const auto regions = this->packedRegions.find(&texture);
+
+    if (regions == std::end(this->packedRegions))
+    {
+        return {};
+    }
+
+    for (const auto& region : regions->second)
+    {
+        const auto& sourceRect = region.sourceRect;
+
+        if (textureRect.left >= sourceRect.left && textureRect.top >= sourceRect.top &&
+            textureRect.left + textureRect.width <= sourceRect.left + sourceRect.width &&
+            textureRect.top + textureRect.height <= sourceRect.top + sourceRect.height)
+        {
+            return TextureRegion{ &this->pages[region.page].renderTexture->getTexture(),
+                { region.position.x + textureRect.left - sourceRect.left, region.position.y + textureRect.top - sourceRect.top,
+                textureRect.width, textureRect.height } };
+        }
+    }
+
+    return {};
+}
+
+bool TextureAtlas::isRejected(const sf::Texture& texture, const sf::IntRect& textureRect) const
+{
+    const auto regions = this->rejectedRegions.find(&texture);
+
+    return regions != std::end(this->rejectedRegions) &&
+        std::find(std::begin(regions->second), std::end(regions->second), textureRect) != std::end(regions->second);
+}
+
+bool TextureAtlas::packRegion(const sf::Texture& texture, const sf::IntRect& sourceRect)
+{
+    const auto padding = 2u;
+    const auto maxPages = 4u;
+
+    const sf::Vector2u size(sourceRect.width + padding, sourceRect.height + padding);
+    sf::Vector2u position;
+
+    std::size_t pageIndex = 0u;
+
+    while (pageIndex < this->pages.size() && !this->allocate(this->pages[pageIndex], size, position))
+    {
+        ++pageIndex;
+    }
+
+    if (pageIndex == this->pages.size() && (this->pages.size() == maxPages || !this->addPage() ||
+        !this->allocate(this->pages.back(), size, position)))
+    {
+        return false;
+    }
+
+    if (this->packingFence)
+    {
+        this->packingFence();
+    }
+
+    auto& renderTexture = *this->pages[pageIndex].renderTexture;
+
+    sf::Sprite sprite(texture, sourceRect);
+    sprite.setPosition(static_cast<float>(position.x), static_cast<float>(position.y));
+
+    renderTexture.draw(sprite, sf::RenderStates(sf::BlendNone));
+    renderTexture.display();
+
+    this->packedRegions[&texture].push_back({ sourceRect, pageIndex, sf::Vector2i(position) });
+
+    return true;
+}
+
+bool TextureAtlas::allocate(Page& page, const sf::Vector2u& size, sf::Vector2u& position)
+{
+    auto shelfPosition = page.shelfPosition;
+    auto shelfHeight = page.shelfHeight;
+
+    if (shelfPosition.x + size.x > this->pageSize)
+    {
+        shelfPosition = { 0u, shelfPosition.y + shelfHeight };
+        shelfHeight = 0u;
+    }
+
+    if (size.x > this->pageSize || shelfPosition.y + size.y > this->pageSize)
+    {
+        return false;
+    }
+
+    position = shelfPosition;
+
+    page.shelfPosition = { shelfPosition.x + size.x, shelfPosition.y };
+    page.shelfHeight = std::max(shelfHeight, size.y);
+
+    return true;
+}
+
+bool TextureAtlas::addPage()
+{
+    auto renderTexture = std::make_unique<sf::RenderTexture>();
+
+    if (!renderTexture->create(this->pageSize, this->pageSize))
+    {
+        return false;
+    }
+
+    renderTexture->clear(sf::Color::Transparent);
+    renderTexture->display();
+
+    this->pages.push_back({ std::move(renderTexture), { 0u, 0u }, 0u });
+
+    return true;
+}
\ No newline at end of file
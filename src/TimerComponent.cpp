@@ -33,7 +33,7 @@ TimerComponent::TimerComponent(const std::string& fileName) :
 
         iStream >> timerName >> durationTime;
 
-        timers.emplace(timerName, std::make_pair(thor::Timer(), durationTime));
+        timers.emplace(timerName, std::make_pair(SimulationTimer(), durationTime));
     }
 }
 
@@ -51,7 +51,7 @@ void TimerComponent::update()
 
 void TimerComponent::addTimer(const std::string& timer, float time)
 {
-    this->timers[timer] = std::make_pair(thor::Timer(), time);
+    this->timers[timer] = std::make_pair(SimulationTimer(), time);
 }
 
 void TimerComponent::addCallbackTimer(std::function<void()> function, float callbackTime)
@@ -6,6 +6,7 @@ InversePalindrome.com
 
 
 #include "UnderWaterDisplay.hpp"
+#include "RenderStatistics.hpp"
 
 
 UnderWaterDisplay::UnderWaterDisplay(ResourceManager& resourceManager)
@@ -29,4 +30,6 @@ void UnderWaterDisplay::draw(sf::RenderTarget& target, sf::RenderStates states)
     states.transform *= this->getTransform();
 
     target.draw(this->bubbleSprite, states);
+
+    Statistics::renderStatistics.recordDraw(this->bubbleSprite, states);
 }
\ No newline at end of file